@@ -0,0 +1,125 @@
+#include "vw/config/options_cli.h"
+#include "vw/core/example.h"
+#include "vw/core/vw.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Measures predictions/sec of the ensemble reductions bag, cover and bootstrap, which score every member of the
+// ensemble for each example. The contextual bandit benchmarks are parameterized by (ensemble size, number of actions)
+// and the bootstrap benchmark by (rounds, number of features).
+
+namespace
+{
+std::string random_features(std::mt19937& rng, const std::string& ns, int num_features)
+{
+  std::uniform_int_distribution<int> index(0, 9999);
+  std::uniform_real_distribution<float> value(0.f, 1.f);
+
+  std::stringstream ss;
+  ss << " |" << ns;
+  for (int i = 0; i < num_features; i++) { ss << " " << index(rng) << ":" << value(rng); }
+  return ss.str();
+}
+
+VW::multi_ex read_decision(VW::workspace& vw, std::mt19937& rng, int num_actions, bool labeled)
+{
+  VW::multi_ex examples;
+  examples.push_back(VW::read_example(vw, "shared" + random_features(rng, "u", 20)));
+  for (int a = 0; a < num_actions; a++)
+  {
+    const std::string label = (labeled && a == 0) ? "0:" + std::to_string(rng() % 2) + ":0.5" : "";
+    examples.push_back(VW::read_example(vw, label + random_features(rng, "a", 10)));
+  }
+  return examples;
+}
+
+void run_adf_predict(benchmark::State& state, const std::string& explore, const std::string& cb_type)
+{
+  const auto ensemble_size = state.range(0);
+  const auto num_actions = static_cast<int>(state.range(1));
+
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(std::vector<std::string>{"--quiet",
+      "--cb_explore_adf", explore, std::to_string(ensemble_size), "--cb_type", cb_type, "-q", "ua"}));
+
+  std::mt19937 rng(3);
+  for (int i = 0; i < 100; i++)
+  {
+    auto examples = read_decision(*vw, rng, num_actions, true);
+    vw->learn(examples);
+    vw->finish_example(examples);
+  }
+
+  std::vector<VW::multi_ex> queries;
+  for (int i = 0; i < 8; i++) { queries.push_back(read_decision(*vw, rng, num_actions, false)); }
+
+  size_t next = 0;
+  for (auto _ : state)
+  {
+    auto& examples = queries[next++ % queries.size()];
+    vw->predict(examples);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  for (auto& examples : queries) { vw->finish_example(examples); }
+}
+
+void adf_args(benchmark::internal::Benchmark* b)
+{
+  for (int64_t ensemble_size : {4, 16})
+  {
+    for (int64_t actions : {10, 100}) { b->Args({ensemble_size, actions}); }
+  }
+}
+}  // namespace
+
+static void bench_bag_predict(benchmark::State& state, const std::string& cb_type)
+{
+  run_adf_predict(state, "--bag", cb_type);
+}
+
+static void bench_cover_predict(benchmark::State& state, const std::string& cb_type)
+{
+  run_adf_predict(state, "--cover", cb_type);
+}
+
+static void bench_bootstrap_predict(benchmark::State& state)
+{
+  const auto rounds = state.range(0);
+  const auto num_features = static_cast<int>(state.range(1));
+
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(
+      std::vector<std::string>{"--quiet", "--bootstrap", std::to_string(rounds)}));
+
+  std::mt19937 rng(3);
+  for (int i = 0; i < 100; i++)
+  {
+    auto* ex = VW::read_example(*vw, std::to_string(rng() % 2) + random_features(rng, "", num_features));
+    vw->learn(*ex);
+    vw->finish_example(*ex);
+  }
+
+  std::vector<VW::example*> queries;
+  for (int i = 0; i < 16; i++) { queries.push_back(VW::read_example(*vw, random_features(rng, "", num_features))); }
+
+  size_t next = 0;
+  for (auto _ : state)
+  {
+    auto* ex = queries[next++ % queries.size()];
+    vw->predict(*ex);
+    benchmark::DoNotOptimize(ex->pred.scalar);
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  for (auto* ex : queries) { vw->finish_example(*ex); }
+}
+
+BENCHMARK_CAPTURE(bench_bag_predict, ips, "ips")->Apply(adf_args);
+BENCHMARK_CAPTURE(bench_bag_predict, mtr, "mtr")->Apply(adf_args);
+BENCHMARK_CAPTURE(bench_cover_predict, mtr, "mtr")->Apply(adf_args);
+BENCHMARK(bench_bootstrap_predict)->ArgsProduct({{4, 16}, {10, 100}});
@@ -0,0 +1,89 @@
+#include "vw/config/options_cli.h"
+#include "vw/core/example.h"
+#include "vw/core/vw.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Measures queries/sec of the leaf scan in eigen_memory_tree and memory_tree as the leaf grows. Each benchmark
+// is parameterized by (leaf size, scan threads).
+
+namespace
+{
+std::string random_example_line(std::mt19937& rng, int label, int num_features)
+{
+  std::uniform_int_distribution<int> index(0, 999);
+  std::uniform_real_distribution<float> value(0.f, 1.f);
+
+  std::stringstream ss;
+  if (label > 0) { ss << label; }
+  ss << " |";
+  for (int i = 0; i < num_features; i++) { ss << " " << index(rng) << ":" << value(rng); }
+  return ss.str();
+}
+
+void run_leaf_scan(benchmark::State& state, VW::workspace& vw, int64_t num_memories)
+{
+  std::mt19937 rng(7);
+
+  for (int64_t i = 0; i < num_memories; i++)
+  {
+    auto* ex = VW::read_example(vw, random_example_line(rng, static_cast<int>(i % 10) + 1, 30));
+    vw.learn(*ex);
+    vw.finish_example(*ex);
+  }
+
+  std::vector<VW::example*> queries;
+  for (int i = 0; i < 16; i++) { queries.push_back(VW::read_example(vw, random_example_line(rng, 0, 30))); }
+
+  size_t next = 0;
+  for (auto _ : state)
+  {
+    auto* ex = queries[next++ % queries.size()];
+    vw.predict(*ex);
+    benchmark::DoNotOptimize(ex->pred.multiclass);
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  for (auto* ex : queries) { vw.finish_example(*ex); }
+}
+
+void leaf_scan_args(benchmark::internal::Benchmark* b)
+{
+  for (int64_t leaf_size : {16, 128, 1024, 4096})
+  {
+    for (int64_t threads : {0, 4}) { b->Args({leaf_size, threads}); }
+  }
+}
+}  // namespace
+
+static void bench_emt_leaf_scan(benchmark::State& state, const std::string& scorer)
+{
+  const auto leaf_size = state.range(0);
+  const auto threads = state.range(1);
+
+  // The leaf split threshold equals the number of memories so that every query scans one full leaf.
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(std::vector<std::string>{"--quiet", "--emt",
+      "--emt_leaf", std::to_string(leaf_size), "--emt_scorer", scorer, "--emt_threads", std::to_string(threads)}));
+  run_leaf_scan(state, *vw, leaf_size);
+}
+
+static void bench_memory_tree_leaf_scan(benchmark::State& state)
+{
+  const auto leaf_size = state.range(0);
+  const auto threads = state.range(1);
+
+  // With two nodes the leaf capacity is leaf_example_multiplier, so the root holds every memory.
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(std::vector<std::string>{"--quiet",
+      "--memory_tree", "2", "--max_number_of_labels", "10", "--leaf_example_multiplier", std::to_string(leaf_size),
+      "--leaf_scan_threads", std::to_string(threads)}));
+  run_leaf_scan(state, *vw, leaf_size);
+}
+
+BENCHMARK_CAPTURE(bench_emt_leaf_scan, self_consistent_rank, "self_consistent_rank")->Apply(leaf_scan_args);
+BENCHMARK_CAPTURE(bench_emt_leaf_scan, distance, "distance")->Apply(leaf_scan_args);
+BENCHMARK(bench_memory_tree_leaf_scan)->Apply(leaf_scan_args);
@@ -0,0 +1,68 @@
+#include "vw/config/options_cli.h"
+#include "vw/core/example.h"
+#include "vw/core/learner.h"
+#include "vw/core/parser.h"
+#include "vw/core/vw.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Measures examples learned per second by generic_driver with --learner_threads, parameterized by (learner threads,
+// features per example). Examples are parsed before timing starts, so only the learning and finishing is measured.
+// The speedup over one thread is bounded by the number of cores and by the finish lock every example goes through.
+
+namespace
+{
+std::vector<std::string> make_lines(int64_t count, int64_t num_features)
+{
+  std::mt19937 rng(17);
+  std::uniform_int_distribution<int> index(0, 999999);
+  std::uniform_real_distribution<float> value(0.f, 1.f);
+
+  std::vector<std::string> lines;
+  for (int64_t i = 0; i < count; i++)
+  {
+    std::stringstream ss;
+    ss << (i % 2 == 0 ? "1" : "-1") << " |";
+    for (int64_t j = 0; j < num_features; j++) { ss << " " << index(rng) << ":" << value(rng); }
+    lines.push_back(ss.str());
+  }
+  return lines;
+}
+}  // namespace
+
+static void bench_learner_threads(benchmark::State& state)
+{
+  const auto threads = state.range(0);
+  const auto features = state.range(1);
+  constexpr int64_t EXAMPLES = 20000;
+  const auto lines = make_lines(EXAMPLES, features);
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(std::vector<std::string>{"--quiet", "-b", "22",
+        "--loss_function", "logistic", "--example_queue_limit", std::to_string(EXAMPLES), "--learner_threads",
+        std::to_string(threads)}));
+    auto& queue = vw->parser_runtime.example_parser->ready_parsed_examples;
+    for (const auto& line : lines) { queue.push(VW::read_example(*vw, line)); }
+    queue.set_done();
+    state.ResumeTiming();
+
+    VW::LEARNER::generic_driver(*vw);
+
+    state.PauseTiming();
+    vw.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * EXAMPLES);
+}
+
+BENCHMARK(bench_learner_threads)
+    ->ArgsProduct({{1, 2, 4}, {10, 100}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
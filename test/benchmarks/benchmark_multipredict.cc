@@ -0,0 +1,96 @@
+#include "vw/config/options_cli.h"
+#include "vw/core/example.h"
+#include "vw/core/vw.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Measures predictions/sec of oaa and csoaa, which score every class through gd's multipredict. Each benchmark is
+// parameterized by (number of classes, features per example).
+
+namespace
+{
+std::string random_features(std::mt19937& rng, int64_t num_features)
+{
+  std::uniform_int_distribution<int> index(0, 99999);
+  std::uniform_real_distribution<float> value(0.f, 1.f);
+
+  std::stringstream ss;
+  ss << " |";
+  for (int64_t i = 0; i < num_features; i++) { ss << " " << index(rng) << ":" << value(rng); }
+  return ss.str();
+}
+
+void run_multipredict(benchmark::State& state, VW::workspace& vw, const std::vector<std::string>& training_lines,
+    int64_t num_features)
+{
+  std::mt19937 rng(11);
+  for (const auto& label : training_lines)
+  {
+    auto* ex = VW::read_example(vw, label + random_features(rng, num_features));
+    vw.learn(*ex);
+    vw.finish_example(*ex);
+  }
+
+  std::vector<VW::example*> queries;
+  for (int i = 0; i < 16; i++) { queries.push_back(VW::read_example(vw, random_features(rng, num_features))); }
+
+  size_t next = 0;
+  for (auto _ : state)
+  {
+    auto* ex = queries[next++ % queries.size()];
+    vw.predict(*ex);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  for (auto* ex : queries) { vw.finish_example(*ex); }
+}
+
+void multipredict_args(benchmark::internal::Benchmark* b)
+{
+  for (int64_t classes : {10, 100, 1000, 10000})
+  {
+    for (int64_t features : {10, 100}) { b->Args({classes, features}); }
+  }
+}
+}  // namespace
+
+static void bench_oaa_multipredict(benchmark::State& state, const std::string& update_rule)
+{
+  const auto classes = state.range(0);
+  const auto features = state.range(1);
+
+  std::vector<std::string> args = {"--quiet", "--oaa", std::to_string(classes), "-b", "22"};
+  if (!update_rule.empty()) { args.push_back(update_rule); }
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+
+  std::vector<std::string> training_lines;
+  for (int64_t i = 0; i < 64; i++) { training_lines.push_back(std::to_string(i % classes + 1)); }
+  run_multipredict(state, *vw, training_lines, features);
+}
+
+static void bench_csoaa_multipredict(benchmark::State& state)
+{
+  const auto classes = state.range(0);
+  const auto features = state.range(1);
+
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(
+      std::vector<std::string>{"--quiet", "--csoaa", std::to_string(classes), "-b", "22"}));
+
+  std::vector<std::string> training_lines;
+  for (int64_t i = 0; i < 64; i++)
+  {
+    training_lines.push_back(std::to_string(i % classes + 1) + ":0 " + std::to_string((i + 1) % classes + 1) + ":1");
+  }
+  run_multipredict(state, *vw, training_lines, features);
+}
+
+// The default update rule strides weights by 4 floats and --sgd by 1, the two class strides oaa sees most often.
+BENCHMARK_CAPTURE(bench_oaa_multipredict, default, "")->Apply(multipredict_args);
+BENCHMARK_CAPTURE(bench_oaa_multipredict, sgd, "--sgd")->Apply(multipredict_args);
+BENCHMARK(bench_csoaa_multipredict)->Apply(multipredict_args);
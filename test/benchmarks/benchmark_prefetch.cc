@@ -0,0 +1,117 @@
+#include "vw/config/options_cli.h"
+#include "vw/core/array_parameters_dense.h"
+#include "vw/core/example.h"
+#include "vw/core/vw.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Learning and predicting with --weights_prefetch_distance on weight tables smaller and larger than the last level
+// cache. Each benchmark is parameterized by (log2 of the table size, prefetch distance, 0 meaning off). At -b 18 the
+// strided table (4 floats per weight) is 4MB and mostly cached; at -b 24 and -b 26 it is 256MB and 1GB.
+
+namespace
+{
+std::string random_example_line(std::mt19937& rng, int num_features)
+{
+  std::uniform_int_distribution<uint32_t> index;
+  std::uniform_real_distribution<float> value(0.f, 1.f);
+
+  std::stringstream ss;
+  ss << (value(rng) > 0.5f ? 1 : -1);
+  for (const char* ns : {" |a", " |b", " |c"})
+  {
+    ss << ns;
+    for (int i = 0; i < num_features; i++) { ss << " " << index(rng) << ":" << value(rng); }
+  }
+  return ss.str();
+}
+
+void prefetch_args(benchmark::internal::Benchmark* b)
+{
+  for (int64_t bits : {18, 24, 26})
+  {
+    for (int64_t distance : {0, 2, 4, 8, 16}) { b->Args({bits, distance}); }
+  }
+}
+
+std::unique_ptr<VW::workspace> make_workspace(int64_t bits, int64_t distance, const std::vector<std::string>& extra)
+{
+  std::vector<std::string> args = {
+      "--quiet", "-b", std::to_string(bits), "--weights_prefetch_distance", std::to_string(distance)};
+  args.insert(args.end(), extra.begin(), extra.end());
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  // Touch every page first so that page faults are not part of the measurement.
+  vw->weights.dense_weights.set_default_by_index([](VW::weight* w, uint64_t) { w[0] = 0.f; });
+  return vw;
+}
+
+std::vector<VW::example*> make_examples(VW::workspace& vw, int num_features)
+{
+  std::mt19937 rng(7);
+  std::vector<VW::example*> examples;
+  for (int i = 0; i < 64; i++) { examples.push_back(VW::read_example(vw, random_example_line(rng, num_features))); }
+  return examples;
+}
+}  // namespace
+
+// 3 x 40 features and 3 x 1600 quadratic terms per example.
+static void bench_prefetch_learn_quadratic(benchmark::State& state)
+{
+  auto vw = make_workspace(state.range(0), state.range(1), {"-q", "ab", "-q", "bc", "-q", "ac"});
+  auto examples = make_examples(*vw, 40);
+
+  size_t next = 0;
+  for (auto _ : state)
+  {
+    auto* ex = examples[next++ % examples.size()];
+    vw->learn(*ex);
+    benchmark::DoNotOptimize(ex->pred.scalar);
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  for (auto* ex : examples) { vw->finish_example(*ex); }
+}
+
+// 3 x 12 features and 1728 cubic terms per example.
+static void bench_prefetch_learn_cubic(benchmark::State& state)
+{
+  auto vw = make_workspace(state.range(0), state.range(1), {"--cubic", "abc"});
+  auto examples = make_examples(*vw, 12);
+
+  size_t next = 0;
+  for (auto _ : state)
+  {
+    auto* ex = examples[next++ % examples.size()];
+    vw->learn(*ex);
+    benchmark::DoNotOptimize(ex->pred.scalar);
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  for (auto* ex : examples) { vw->finish_example(*ex); }
+}
+
+static void bench_prefetch_predict_quadratic(benchmark::State& state)
+{
+  auto vw = make_workspace(state.range(0), state.range(1), {"-q", "ab", "-q", "bc", "-q", "ac", "-t"});
+  auto examples = make_examples(*vw, 40);
+
+  size_t next = 0;
+  for (auto _ : state)
+  {
+    auto* ex = examples[next++ % examples.size()];
+    vw->predict(*ex);
+    benchmark::DoNotOptimize(ex->pred.scalar);
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  for (auto* ex : examples) { vw->finish_example(*ex); }
+}
+
+BENCHMARK(bench_prefetch_learn_quadratic)->Apply(prefetch_args);
+BENCHMARK(bench_prefetch_learn_cubic)->Apply(prefetch_args);
+BENCHMARK(bench_prefetch_predict_quadratic)->Apply(prefetch_args);
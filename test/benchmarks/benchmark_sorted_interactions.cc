@@ -0,0 +1,115 @@
+#include "vw/config/options_cli.h"
+#include "vw/core/array_parameters_dense.h"
+#include "vw/core/example.h"
+#include "vw/core/reductions/gd.h"
+#include "vw/core/vw.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Predicting examples with two large interacted namespaces, either in the order the terms are generated or in weight
+// address order. Processing interaction terms in address order was proposed as an option and declined: collecting
+// and bucketing the terms costs several times a cached weight access, and with tens of thousands of terms spread
+// over a table larger than the cache, sorting finds no cache lines to share. Each benchmark is parameterized by
+// (log2 of the table size, 0 for the usual order or 1 for address order). At -b 18 the strided table (4 floats per
+// weight) is 4MB; at -b 24 and -b 26 it is 256MB and 1GB. Measured on a single-core VM, in examples per second:
+//
+//   bits    usual order    address order
+//   18      30.8k          5.5k
+//   24      4.4k           2.6k
+//   26      2.1k           1.7k
+//
+// A full implementation of the mode, which also learned in address order, was 1.4-5x slower when learning.
+// --weights_prefetch_distance is the supported way to hide these misses.
+
+namespace
+{
+struct term
+{
+  uint64_t index;
+  float x;
+};
+
+void collect_term(std::vector<term>& terms, float x, uint64_t index) { terms.push_back({index, x}); }
+
+std::string random_example_line(std::mt19937& rng, int num_features)
+{
+  std::uniform_int_distribution<uint32_t> index;
+  std::uniform_real_distribution<float> value(0.f, 1.f);
+
+  std::stringstream ss;
+  ss << (value(rng) > 0.5f ? 1 : -1);
+  for (const char* ns : {" |a", " |b"})
+  {
+    ss << ns;
+    for (int i = 0; i < num_features; i++) { ss << " " << index(rng) << ":" << value(rng); }
+  }
+  return ss.str();
+}
+
+void sorted_interactions_args(benchmark::internal::Benchmark* b)
+{
+  for (int64_t bits : {18, 24, 26})
+  {
+    for (int64_t sorted : {0, 1}) { b->Args({bits, sorted}); }
+  }
+}
+
+// Generates the terms, orders them with a stable counting sort into 256 buckets by the top bits of the masked weight
+// index and sums them in that order.
+float predict_in_address_order(VW::workspace& vw, VW::example& ex, std::vector<term>& terms, std::vector<term>& sorted)
+{
+  terms.clear();
+  VW::foreach_feature<std::vector<term>, uint64_t, collect_term>(vw, ex, terms);
+
+  auto& weights = vw.weights.dense_weights;
+  const uint64_t mask = weights.mask();
+  int shift = 0;
+  while ((mask >> shift) > 255) { shift++; }
+
+  std::array<size_t, 257> starts{};
+  for (const auto& t : terms) { starts[((t.index & mask) >> shift) + 1]++; }
+  for (size_t b = 1; b < starts.size(); b++) { starts[b] += starts[b - 1]; }
+  sorted.resize(terms.size());
+  for (const auto& t : terms) { sorted[starts[(t.index & mask) >> shift]++] = t; }
+
+  float prediction = 0.f;
+  for (const auto& t : sorted) { prediction += weights[t.index] * t.x; }
+  return prediction;
+}
+}  // namespace
+
+// 2 x 150 features and 22500 quadratic terms per example.
+static void bench_sorted_interactions_predict(benchmark::State& state)
+{
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(
+      std::vector<std::string>{"--quiet", "-b", std::to_string(state.range(0)), "-q", "ab", "-t"}));
+  // Touch every page first so that page faults are not part of the measurement.
+  vw->weights.dense_weights.set_default_by_index([](VW::weight* w, uint64_t) { w[0] = 0.f; });
+  const bool sorted = state.range(1) != 0;
+
+  std::mt19937 rng(9);
+  std::vector<VW::example*> examples;
+  for (int i = 0; i < 32; i++) { examples.push_back(VW::read_example(*vw, random_example_line(rng, 150))); }
+
+  std::vector<term> terms;
+  std::vector<term> sorted_terms;
+  size_t next = 0;
+  for (auto _ : state)
+  {
+    auto* ex = examples[next++ % examples.size()];
+    const float prediction =
+        sorted ? predict_in_address_order(*vw, *ex, terms, sorted_terms) : VW::inline_predict(*vw, *ex);
+    benchmark::DoNotOptimize(prediction);
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  for (auto* ex : examples) { vw->finish_example(*ex); }
+}
+
+BENCHMARK(bench_sorted_interactions_predict)->Apply(sorted_interactions_args);
@@ -20,6 +20,20 @@ struct FnData
   void* context;
 };
 
+// Same layout as VW::LEARNER::details::example_dispatch: the function pointer is type erased and a thunk casts it back.
+struct FnThunk
+{
+  void (*thunk)(const FnThunk&, int);
+  void (*fn)();
+  void* context;
+};
+
+template <class ContextT>
+void call_thunk(const FnThunk& f, int x)
+{
+  reinterpret_cast<void (*)(ContextT*, int)>(f.fn)(static_cast<ContextT*>(f.context), x);
+}
+
 void add_fn(Context* context, int x)
 {
   // read value, add, and write back
@@ -44,6 +58,7 @@ struct TestObj
   std::unique_ptr<Context> context;
 
   FnData fn_obj;
+  FnThunk fn_thunk;
   std::function<FnPtrContext> std_function;
   std::function<FnPtrBound> std_function_bind;
   std::function<FnPtrBound> std_function_lambda;
@@ -56,6 +71,7 @@ struct TestObj
     {
       fn_obj.fn = reinterpret_cast<FnPtrVoid*>(add_fn_noinline);
       fn_obj.context = context_ptr;
+      fn_thunk = FnThunk{call_thunk<Context>, reinterpret_cast<void (*)()>(add_fn_noinline), context_ptr};
       std_function = add_fn_noinline;
       std_function_bind = std::bind(add_fn_noinline, context_ptr, std::placeholders::_1);
       std_function_lambda = [context_ptr](int x) { add_fn_noinline(context_ptr, x); };
@@ -64,6 +80,7 @@ struct TestObj
     {
       fn_obj.fn = reinterpret_cast<FnPtrVoid*>(add_fn);
       fn_obj.context = context_ptr;
+      fn_thunk = FnThunk{call_thunk<Context>, reinterpret_cast<void (*)()>(add_fn), context_ptr};
       std_function = add_fn;
       std_function_bind = std::bind(add_fn, context_ptr, std::placeholders::_1);
       std_function_lambda = [context_ptr](int x) { add_fn(context_ptr, x); };
@@ -102,6 +119,17 @@ void function_call_pointer(benchmark::State& state)
   }
 }
 
+template <bool noinline>
+void function_call_thunk(benchmark::State& state)
+{
+  TestObj<noinline> test;
+  for (auto _ : state)
+  {
+    test.fn_thunk.thunk(test.fn_thunk, 1);
+    benchmark::ClobberMemory();
+  }
+}
+
 template <bool noinline>
 void function_call_std_function(benchmark::State& state)
 {
@@ -140,6 +168,8 @@ BENCHMARK(function_call_direct);
 BENCHMARK(function_call_direct_noinline);
 BENCHMARK(function_call_pointer<false>)->Name("function_call_pointer");
 BENCHMARK(function_call_pointer<true>)->Name("function_call_pointer_noinline");
+BENCHMARK(function_call_thunk<false>)->Name("function_call_thunk");
+BENCHMARK(function_call_thunk<true>)->Name("function_call_thunk_noinline");
 BENCHMARK(function_call_std_function<false>)->Name("function_call_std_function");
 BENCHMARK(function_call_std_function<true>)->Name("function_call_std_function_noinline");
 BENCHMARK(function_call_std_function_bind<false>)->Name("function_call_std_function_bind");
@@ -151,14 +181,16 @@ BENCHMARK(function_call_std_function_lambda<true>)->Name("function_call_std_func
 -------------------------------------------------------------------------------------
 Benchmark                                           Time             CPU   Iterations
 -------------------------------------------------------------------------------------
-function_call_direct                            0.331 ns        0.331 ns   1000000000
-function_call_direct_noinline                    1.37 ns         1.37 ns    496880302
-function_call_pointer                            2.02 ns         2.02 ns    350094350
-function_call_pointer_noinline                   2.02 ns         2.02 ns    343273218
-function_call_std_function                       2.66 ns         2.66 ns    255542722
-function_call_std_function_noinline              2.63 ns         2.63 ns    260247041
-function_call_std_function_bind                  2.33 ns         2.33 ns    283716344
-function_call_std_function_bind_noinline         2.35 ns         2.35 ns    291974213
-function_call_std_function_lambda                2.02 ns         2.02 ns    334876957
-function_call_std_function_lambda_noinline       2.75 ns         2.75 ns    249497886
+function_call_direct                            0.467 ns        0.437 ns   1000000000
+function_call_direct_noinline                    2.09 ns         2.07 ns    333040480
+function_call_pointer                            3.30 ns         3.26 ns    213724052
+function_call_pointer_noinline                   3.44 ns         3.29 ns    214330546
+function_call_thunk                              3.36 ns         3.32 ns    215834967
+function_call_thunk_noinline                     3.39 ns         3.35 ns    208422036
+function_call_std_function                       3.81 ns         3.77 ns    187622919
+function_call_std_function_noinline              3.35 ns         3.28 ns    218721844
+function_call_std_function_bind                  3.76 ns         3.62 ns    188605540
+function_call_std_function_bind_noinline         4.06 ns         4.01 ns    174548594
+function_call_std_function_lambda                3.13 ns         3.10 ns    222544148
+function_call_std_function_lambda_noinline       3.73 ns         3.68 ns    176562970
 */
@@ -0,0 +1,104 @@
+#include "vw/config/options_cli.h"
+#include "vw/core/example.h"
+#include "vw/core/vw.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Measures predictions/sec of plt and recall_tree, which score many tree nodes or candidate labels per example. Each
+// plt benchmark is parameterized by (number of labels, tree arity, top k), where a top k of 0 predicts every label
+// above a probability threshold instead.
+
+namespace
+{
+std::string random_features(std::mt19937& rng, int num_features)
+{
+  std::uniform_int_distribution<int> index(0, 9999);
+  std::uniform_real_distribution<float> value(0.f, 1.f);
+
+  std::stringstream ss;
+  ss << " |";
+  for (int i = 0; i < num_features; i++) { ss << " " << index(rng) << ":" << value(rng); }
+  return ss.str();
+}
+
+void run_tree_predict(
+    benchmark::State& state, VW::workspace& vw, const std::vector<std::string>& training_labels, int num_features)
+{
+  std::mt19937 rng(5);
+  for (const auto& label : training_labels)
+  {
+    auto* ex = VW::read_example(vw, label + random_features(rng, num_features));
+    vw.learn(*ex);
+    vw.finish_example(*ex);
+  }
+
+  std::vector<VW::example*> queries;
+  for (int i = 0; i < 16; i++) { queries.push_back(VW::read_example(vw, random_features(rng, num_features))); }
+
+  size_t next = 0;
+  for (auto _ : state)
+  {
+    auto* ex = queries[next++ % queries.size()];
+    vw.predict(*ex);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  for (auto* ex : queries) { vw.finish_example(*ex); }
+}
+
+void plt_args(benchmark::internal::Benchmark* b)
+{
+  for (int64_t labels : {1000, 100000})
+  {
+    for (int64_t kary : {2, 16})
+    {
+      for (int64_t top_k : {0, 1, 10}) { b->Args({labels, kary, top_k}); }
+    }
+  }
+}
+}  // namespace
+
+static void bench_plt(benchmark::State& state)
+{
+  const auto labels = state.range(0);
+  const auto kary = state.range(1);
+  const auto top_k = state.range(2);
+
+  std::vector<std::string> args = {"--quiet", "--plt", std::to_string(labels), "--kary_tree", std::to_string(kary),
+      "--loss_function", "logistic", "-b", "22"};
+  if (top_k > 0) { args.insert(args.end(), {"--top_k", std::to_string(top_k)}); }
+  else { args.insert(args.end(), {"--threshold", "0.05"}); }
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+
+  std::mt19937 rng(3);
+  std::uniform_int_distribution<int64_t> label(0, labels - 1);
+  std::vector<std::string> training_labels;
+  for (int i = 0; i < 256; i++)
+  {
+    training_labels.push_back(std::to_string(label(rng)) + "," + std::to_string(label(rng)));
+  }
+  run_tree_predict(state, *vw, training_labels, 30);
+}
+
+static void bench_recall_tree(benchmark::State& state)
+{
+  const auto classes = state.range(0);
+  const auto max_candidates = state.range(1);
+
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(
+      std::vector<std::string>{"--quiet", "--recall_tree", std::to_string(classes), "--max_candidates",
+          std::to_string(max_candidates), "--loss_function", "logistic", "-b", "22"}));
+
+  std::vector<std::string> training_labels;
+  for (int64_t i = 0; i < 4 * classes; i++) { training_labels.push_back(std::to_string(i % classes + 1)); }
+  run_tree_predict(state, *vw, training_labels, 30);
+}
+
+BENCHMARK(bench_plt)->Apply(plt_args);
+BENCHMARK(bench_recall_tree)->Args({100, 20})->Args({1000, 40})->Args({1000, 200});
@@ -0,0 +1,111 @@
+#include "vw/config/options_cli.h"
+#include "vw/core/array_parameters_dense.h"
+#include "vw/core/example.h"
+#include "vw/core/vw.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Measures random access to dense weight tables larger than the TLB reach, allocated with each --weights_huge_pages
+// mode. Each benchmark is parameterized by (log2 of the table size, huge pages mode: 0 none, 1 transparent,
+// 2 explicit). Items/s gives the throughput; run the binary under
+//   perf stat -e dTLB-load-misses,dTLB-store-misses ./vw-benchmarks.out --benchmark_filter=<name>/<bits>/<mode>
+// to get the TLB misses behind it. Explicit huge pages need a reserved pool (vm.nr_hugepages), otherwise mode 2 falls
+// back to transparent huge pages.
+
+namespace
+{
+VW::huge_pages_mode huge_pages_arg(int64_t mode)
+{
+  if (mode == 1) { return VW::huge_pages_mode::TRANSPARENT; }
+  if (mode == 2) { return VW::huge_pages_mode::EXPLICIT; }
+  return VW::huge_pages_mode::NONE;
+}
+
+const char* huge_pages_option(int64_t mode)
+{
+  if (mode == 1) { return "transparent"; }
+  if (mode == 2) { return "explicit"; }
+  return "none";
+}
+
+std::string random_example_line(std::mt19937& rng, int num_features)
+{
+  std::uniform_int_distribution<uint32_t> index;
+  std::uniform_real_distribution<float> value(0.f, 1.f);
+
+  std::stringstream ss;
+  ss << (value(rng) > 0.5f ? 1 : -1) << " |a";
+  for (int i = 0; i < num_features; i++) { ss << " " << index(rng) << ":" << value(rng); }
+  ss << " |b";
+  for (int i = 0; i < num_features; i++) { ss << " " << index(rng) << ":" << value(rng); }
+  return ss.str();
+}
+
+void weights_memory_args(benchmark::internal::Benchmark* b)
+{
+  for (int64_t bits : {20, 24, 26})
+  {
+    for (int64_t mode : {0, 1, 2}) { b->Args({bits, mode}); }
+  }
+}
+}  // namespace
+
+// gd-style read-modify-write of the weight and its adaptive slot at uniformly random indices.
+static void bench_dense_random_update(benchmark::State& state)
+{
+  const auto bits = state.range(0);
+  VW::dense_allocation_options allocation;
+  allocation.huge_pages = huge_pages_arg(state.range(1));
+  VW::dense_parameters weights(static_cast<size_t>(1) << bits, 2, allocation);
+  // Touch every page first so that page faults are not part of the measurement.
+  weights.set_default_by_index([](VW::weight* w, uint64_t) { w[1] = 1.f; });
+
+  std::mt19937_64 rng(3);
+  std::vector<uint64_t> indices(1 << 16);
+  for (auto& index : indices) { index = (rng() & (weights.mask() >> 2)) << 2; }
+
+  for (auto _ : state)
+  {
+    for (uint64_t index : indices)
+    {
+      VW::weight* w = &weights[index];
+      w[1] += 0.25f;
+      w[0] += 0.01f / w[1];
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * indices.size());
+}
+
+// Learning examples whose 2 x 50 features and 2500 quadratic terms land all over a -b <bits> table.
+static void bench_learn_huge_pages(benchmark::State& state)
+{
+  const auto bits = state.range(0);
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(std::vector<std::string>{"--quiet", "-b",
+      std::to_string(bits), "-q", "ab", "--weights_huge_pages", huge_pages_option(state.range(1))}));
+  // Touch every page first so that page faults are not part of the measurement.
+  vw->weights.dense_weights.set_default_by_index([](VW::weight* w, uint64_t) { w[0] = 0.f; });
+
+  std::mt19937 rng(5);
+  std::vector<VW::example*> examples;
+  for (int i = 0; i < 64; i++) { examples.push_back(VW::read_example(*vw, random_example_line(rng, 50))); }
+
+  size_t next = 0;
+  for (auto _ : state)
+  {
+    auto* ex = examples[next++ % examples.size()];
+    vw->learn(*ex);
+    benchmark::DoNotOptimize(ex->pred.scalar);
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  for (auto* ex : examples) { vw->finish_example(*ex); }
+}
+
+BENCHMARK(bench_dense_random_update)->Apply(weights_memory_args);
+BENCHMARK(bench_learn_huge_pages)->Apply(weights_memory_args);
@@ -7,6 +7,43 @@ import time
 
 DAEMON_PORT = 54252
 
+
+def read_predictions(file_name):
+    with open(file_name) as f:
+        return [line.split()[0] for line in f]
+
+
+def write_tagged(input_file, num_tags, output_file):
+    # Tags cycle so that every tag has examples spread through the file.
+    with open(input_file) as f, open(output_file, "w") as out:
+        for i, line in enumerate(f):
+            label, features = line.split("|", 1)
+            out.write(f"{label.strip()} 'tag{i % num_tags} |{features}")
+
+
+def check_round_robin(input_file, num_daemons, predictions):
+    # The learner calls both predict and learn on the sender, so every example is sent twice in a row. Spread round
+    # robin over two daemons, one daemon receives the first send of every example and the other the second, so both
+    # learn from the same sequence. The two predictions reported for an example must then be equal, which they are
+    # only if the sender puts each daemon's results back in send order.
+    with open(input_file) as f:
+        num_examples = sum(1 for _ in f)
+    if num_daemons != 2 or len(predictions) != 2 * num_examples:
+        print(
+            f"Expected 2 daemons and 2 predictions per example, got {num_daemons} daemons and "
+            f"{len(predictions)} predictions for {num_examples} examples"
+        )
+        return False
+    for i in range(num_examples):
+        if predictions[2 * i] != predictions[2 * i + 1]:
+            print(
+                f"Example {i} was predicted as {predictions[2 * i]} by one daemon and {predictions[2 * i + 1]} "
+                "by the other"
+            )
+            return False
+    return True
+
+
 if __name__ == "__main__":
     parser = argparse.ArgumentParser()
     parser.add_argument(
@@ -18,30 +55,72 @@ if __name__ == "__main__":
         type=str,
         required=True,
     )
+    parser.add_argument(
+        "--daemons", help="Number of daemons to send to", type=int, default=1
+    )
+    parser.add_argument(
+        "--port",
+        help="Port of the first daemon, the others use the ports after it",
+        type=int,
+        default=DAEMON_PORT,
+    )
+    parser.add_argument(
+        "--sender_args",
+        help="Extra arguments for the sender",
+        type=str,
+        default="",
+    )
+    parser.add_argument(
+        "--tags",
+        help="Tag the examples with this many distinct tags before sending them",
+        type=int,
+        default=0,
+    )
+    parser.add_argument(
+        "--predictions",
+        help="File the sender writes its predictions to",
+        type=str,
+        default="sender_test.predict",
+    )
+    parser.add_argument(
+        "--check_round_robin",
+        help="Check that two daemons sent to round robin report matching predictions in order",
+        action="store_true",
+    )
     args = parser.parse_args()
 
-    daemon_opts = [
-        args.vw,
-        "--daemon",
-        "--foreground",
-        f"--port={DAEMON_PORT}",
-        "--num_children=1",
-    ]
+    input_file = args.input_file
+    if args.tags > 0:
+        input_file = "sender_test.tagged"
+        write_tagged(args.input_file, args.tags, input_file)
 
-    print("Starting vw daemon with args: " + " ".join(daemon_opts[1:]))
-    vw_daemon_proc = subprocess.Popen(
-        daemon_opts, stdout=subprocess.PIPE, stderr=subprocess.PIPE
-    )
+    vw_daemon_procs = []
+    for i in range(args.daemons):
+        daemon_opts = [
+            args.vw,
+            "--daemon",
+            "--foreground",
+            f"--port={args.port + i}",
+            "--num_children=1",
+        ]
+
+        print("Starting vw daemon with args: " + " ".join(daemon_opts[1:]))
+        vw_daemon_procs.append(
+            subprocess.Popen(
+                daemon_opts, stdout=subprocess.PIPE, stderr=subprocess.PIPE
+            )
+        )
     # Give daemon a moment to start the socket
     time.sleep(0.1)
 
-    sender_opts = [
-        args.vw,
-        "--sendto",
-        f"localhost:{DAEMON_PORT}",
-        f"--data={args.input_file}",
-        "--predictions=sender_test.predict",
+    sender_opts = [args.vw]
+    for i in range(args.daemons):
+        sender_opts += ["--sendto", f"localhost:{args.port + i}"]
+    sender_opts += [
+        f"--data={input_file}",
+        f"--predictions={args.predictions}",
     ]
+    sender_opts += args.sender_args.split()
     print("Starting vw sender with args: " + " ".join(sender_opts[1:]))
     sender_proc = subprocess.Popen(
         sender_opts, stdout=subprocess.PIPE, stderr=subprocess.PIPE
@@ -53,19 +132,38 @@ if __name__ == "__main__":
     if sender_proc.stderr:
         print("Sender STDERR: \n" + sender_proc.stderr.read().decode("utf-8"))
 
+    failed = False
     if return_code != 0:
         print("VW failed")
-        # Kill daemon process
-        os.kill(vw_daemon_proc.pid, signal.SIGTERM)
+        failed = True
 
     # Check if daemon failed.
-    daemon_none_or_return_code = vw_daemon_proc.poll()
-    if daemon_none_or_return_code is not None:
-        if vw_daemon_proc.stdout:
-            print("Daemon STDOUT: \n" + vw_daemon_proc.stdout.read().decode("utf-8"))
-        if vw_daemon_proc.stderr:
-            print("Daemon STDOUT: \n" + vw_daemon_proc.stderr.read().decode("utf-8"))
-        sys.exit(1)
+    for vw_daemon_proc in vw_daemon_procs:
+        daemon_none_or_return_code = vw_daemon_proc.poll()
+        if daemon_none_or_return_code is not None:
+            if vw_daemon_proc.stdout:
+                print(
+                    "Daemon STDOUT: \n" + vw_daemon_proc.stdout.read().decode("utf-8")
+                )
+            if vw_daemon_proc.stderr:
+                print(
+                    "Daemon STDOUT: \n" + vw_daemon_proc.stderr.read().decode("utf-8")
+                )
+            failed = True
 
     # Kill daemon process
-    os.kill(vw_daemon_proc.pid, signal.SIGTERM)
+    for vw_daemon_proc in vw_daemon_procs:
+        if vw_daemon_proc.poll() is None:
+            os.kill(vw_daemon_proc.pid, signal.SIGTERM)
+            vw_daemon_proc.wait()
+
+    if args.tags > 0:
+        os.remove(input_file)
+
+    if not failed and args.check_round_robin:
+        failed = not check_round_robin(
+            args.input_file, args.daemons, read_predictions(args.predictions)
+        )
+
+    if failed:
+        sys.exit(1)
@@ -113,6 +113,17 @@ extern "C"
   VW_DLL_PUBLIC size_t VW_CALLING_CONV VW_HashFeatureA(VW_HANDLE handle, const char* s, size_t u);
   VW_DLL_PUBLIC size_t VW_CALLING_CONV VW_HashFeatureStaticA(
       const char* s, size_t u, const char* h, unsigned int num_bits);
+  // The static hashes above use murmur3. These take the --hash_algorithm of the model, "murmur3" or "wyhash".
+#ifdef USE_CODECVT
+  VW_DLL_PUBLIC size_t VW_CALLING_CONV VW_HashSpaceStaticWithAlgorithm(
+      const char16_t* s, const char16_t* h, const char16_t* algorithm);
+  VW_DLL_PUBLIC size_t VW_CALLING_CONV VW_HashFeatureStaticWithAlgorithm(
+      const char16_t* s, size_t u, const char16_t* h, unsigned int num_bits, const char16_t* algorithm);
+#endif
+  VW_DLL_PUBLIC size_t VW_CALLING_CONV VW_HashSpaceStaticWithAlgorithmA(
+      const char* s, const char* h, const char* algorithm);
+  VW_DLL_PUBLIC size_t VW_CALLING_CONV VW_HashFeatureStaticWithAlgorithmA(
+      const char* s, size_t u, const char* h, unsigned int num_bits, const char* algorithm);
 
   VW_DLL_PUBLIC float VW_CALLING_CONV VW_Learn(VW_HANDLE handle, VW_EXAMPLE e);
   VW_DLL_PUBLIC float VW_CALLING_CONV VW_Predict(VW_HANDLE handle, VW_EXAMPLE e);
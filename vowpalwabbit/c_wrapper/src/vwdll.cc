@@ -319,6 +319,34 @@ extern "C"
     return VW::hash_feature_static(str, u, hash, num_bits);
   }
 
+#ifdef USE_CODECVT
+  VW_DLL_PUBLIC size_t VW_CALLING_CONV VW_HashSpaceStaticWithAlgorithm(
+      const char16_t* s, const char16_t* h, const char16_t* algorithm)
+  {
+    return VW_HashSpaceStaticWithAlgorithmA(
+        utf16_to_utf8(s).c_str(), utf16_to_utf8(h).c_str(), utf16_to_utf8(algorithm).c_str());
+  }
+
+  VW_DLL_PUBLIC size_t VW_CALLING_CONV VW_HashFeatureStaticWithAlgorithm(
+      const char16_t* s, size_t u, const char16_t* h, unsigned int num_bits, const char16_t* algorithm)
+  {
+    return VW_HashFeatureStaticWithAlgorithmA(
+        utf16_to_utf8(s).c_str(), u, utf16_to_utf8(h).c_str(), num_bits, utf16_to_utf8(algorithm).c_str());
+  }
+#endif
+
+  VW_DLL_PUBLIC size_t VW_CALLING_CONV VW_HashSpaceStaticWithAlgorithmA(
+      const char* s, const char* h, const char* algorithm)
+  {
+    return VW::hash_space_static(s, h, algorithm);
+  }
+
+  VW_DLL_PUBLIC size_t VW_CALLING_CONV VW_HashFeatureStaticWithAlgorithmA(
+      const char* s, size_t u, const char* h, unsigned int num_bits, const char* algorithm)
+  {
+    return VW::hash_feature_static(s, u, h, num_bits, algorithm);
+  }
+
   VW_DLL_PUBLIC void VW_CALLING_CONV VW_AddLabel(VW_EXAMPLE e, float label, float weight, float base)
   {
     auto* ex = static_cast<VW::example*>(e);
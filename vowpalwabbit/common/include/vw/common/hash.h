@@ -119,12 +119,127 @@ VW_STD14_CONSTEXPR inline uint32_t murmurhash_x86_32(const char* data, size_t le
 
   return details::fmix(h1);
 }
+
+//-----------------------------------------------------------------------------
+// wyhash (final version 4), by Wang Yi, placed in the public domain.
+// https://github.com/wangyi-fudan/wyhash
+//
+// Reads the input a machine word at a time and mixes with 64x64->128 bit multiplies, which makes it several times
+// faster than murmurhash_x86_32 on feature-length strings. Like murmurhash_x86_32 it assumes a little-endian machine.
+
+// 64x64->128 bit multiply, returning the low and high halves in a and b.
+inline void wymum(uint64_t& a, uint64_t& b) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+  __uint128_t r = a;
+  r *= b;
+  a = static_cast<uint64_t>(r);
+  b = static_cast<uint64_t>(r >> 64);
+#else
+  const uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>(a), lb = static_cast<uint32_t>(b);
+  const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+  const uint64_t t = rl + (rm0 << 32);
+  uint64_t c = t < rl;
+  const uint64_t lo = t + (rm1 << 32);
+  c += lo < t;
+  a = lo;
+  b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+inline uint64_t wymix(uint64_t a, uint64_t b) noexcept
+{
+  wymum(a, b);
+  return a ^ b;
+}
+
+inline uint64_t wyr8(const char* p) noexcept
+{
+  uint64_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+inline uint64_t wyr4(const char* p) noexcept
+{
+  uint32_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+inline uint64_t wyr3(const char* p, size_t k) noexcept
+{
+  return (static_cast<uint64_t>(static_cast<uint8_t>(p[0])) << 16) |
+      (static_cast<uint64_t>(static_cast<uint8_t>(p[k >> 1])) << 8) | static_cast<uint8_t>(p[k - 1]);
+}
+
+inline uint64_t wyhash(const char* data, size_t len, uint64_t seed) noexcept
+{
+  constexpr uint64_t secret[4] = {
+      0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull};
+
+  const char* p = data;
+  seed ^= wymix(seed ^ secret[0], secret[1]);
+  uint64_t a;
+  uint64_t b;
+  if (len <= 16)
+  {
+    if (len >= 4)
+    {
+      a = (wyr4(p) << 32) | wyr4(p + ((len >> 3) << 2));
+      b = (wyr4(p + len - 4) << 32) | wyr4(p + len - 4 - ((len >> 3) << 2));
+    }
+    else if (len > 0)
+    {
+      a = wyr3(p, len);
+      b = 0;
+    }
+    else { a = b = 0; }
+  }
+  else
+  {
+    size_t i = len;
+    if (i > 48)
+    {
+      uint64_t see1 = seed;
+      uint64_t see2 = seed;
+      do
+      {
+        seed = wymix(wyr8(p) ^ secret[1], wyr8(p + 8) ^ seed);
+        see1 = wymix(wyr8(p + 16) ^ secret[2], wyr8(p + 24) ^ see1);
+        see2 = wymix(wyr8(p + 32) ^ secret[3], wyr8(p + 40) ^ see2);
+        p += 48;
+        i -= 48;
+      } while (i > 48);
+      seed ^= see1 ^ see2;
+    }
+    while (i > 16)
+    {
+      seed = wymix(wyr8(p) ^ secret[1], wyr8(p + 8) ^ seed);
+      i -= 16;
+      p += 16;
+    }
+    a = wyr8(p + i - 16);
+    b = wyr8(p + i - 8);
+  }
+  a ^= secret[1];
+  b ^= seed;
+  wymum(a, b);
+  return wymix(a ^ secret[0] ^ len, b ^ secret[1]);
+}
 }  // namespace details
 
 VW_STD14_CONSTEXPR inline uint32_t uniform_hash(const char* data, size_t len, uint32_t seed)
 {
   return details::murmurhash_x86_32(data, len, seed);
 }
+
+// Drop-in alternative to uniform_hash, selected with --hash_algorithm wyhash. The 64 bit hash is truncated to the 32
+// bits used for feature indices.
+inline uint32_t uniform_hash_wyhash(const char* data, size_t len, uint32_t seed)
+{
+  return static_cast<uint32_t>(details::wyhash(data, len, seed));
+}
 }  // namespace VW
 
 VW_DEPRECATED("uniform_hash has been moved into VW namespace")
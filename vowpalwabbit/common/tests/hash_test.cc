@@ -56,3 +56,24 @@ TEST(UniformHash, BytesInSignedNegativeRange)
   EXPECT_EQ(VW::uniform_hash("\xd6\xd3\xc3\xe3", 4, 1342134), 1455891233);
   EXPECT_EQ(VW::uniform_hash("\xd6\xd3\xc3\xe3\xa3", 5, 1342134), 1029777931);
 }
+
+TEST(Wyhash, ReferenceVectors)
+{
+  // Test vectors published with wyhash final version 4, seeded with their index.
+  EXPECT_EQ(VW::details::wyhash("", 0, 0), 0x93228a4de0eec5a2ull);
+  EXPECT_EQ(VW::details::wyhash("a", 1, 1), 0xc5bac3db178713c4ull);
+  EXPECT_EQ(VW::details::wyhash("abc", 3, 2), 0xa97f2f7b1d9b3314ull);
+  EXPECT_EQ(VW::details::wyhash("message digest", 14, 3), 0x786d1f1df3801df4ull);
+  EXPECT_EQ(VW::details::wyhash("abcdefghijklmnopqrstuvwxyz", 26, 4), 0xdca5a8138ad37c87ull);
+  EXPECT_EQ(
+      VW::details::wyhash("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", 62, 5), 0xb9e734f117cfaf70ull);
+  EXPECT_EQ(VW::details::wyhash(
+                "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 80, 6),
+      0x6cc5eab49a92d617ull);
+}
+
+TEST(Wyhash, UniformHashWyhashTruncates)
+{
+  EXPECT_EQ(VW::uniform_hash_wyhash("abc", 3, 2), 0x1d9b3314u);
+  EXPECT_NE(VW::uniform_hash_wyhash("test", 4, 0), VW::uniform_hash("test", 4, 0));
+}
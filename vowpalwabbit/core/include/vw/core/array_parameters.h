@@ -38,6 +38,13 @@ public:
     else { dense_weights.set_default(std::forward<Lambda>(default_func)); }
   }
 
+  template <typename Lambda>
+  void set_default_by_index(Lambda&& default_func)
+  {
+    if (sparse) { sparse_weights.set_default_by_index(std::forward<Lambda>(default_func)); }
+    else { dense_weights.set_default_by_index(std::forward<Lambda>(default_func)); }
+  }
+
   inline uint32_t stride_shift() const
   {
     if (sparse) { return sparse_weights.stride_shift(); }
@@ -8,8 +8,15 @@
 
 #include <cassert>
 #include <cstdint>
+#include <functional>
 #include <iterator>
 #include <memory>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#  include <xmmintrin.h>
+#endif
 
 namespace VW
 {
@@ -85,6 +92,57 @@ private:
   uint64_t _stride;
   uint32_t _stride_shift;
 };
+
+/// Number of indexes in each block handed out by parallel_for_blocks.
+constexpr uint64_t PARALLEL_BLOCK_SIZE = static_cast<uint64_t>(1) << 16;
+
+/// Calls func(begin, end) for consecutive blocks of PARALLEL_BLOCK_SIZE indexes covering [0, length), the last one
+/// possibly shorter. The blocks are split into one contiguous run per thread of a VW::thread_pool, with the calling
+/// thread taking the first run, and this returns once every block is done. The block boundaries do not depend on the
+/// number of threads, so per-block partial results combined in block order are the same for any thread count.
+///
+/// A table fresh from the kernel gets each page placed on the NUMA node of the thread that first writes it. Passes
+/// that initialize a table through this therefore spread it over the nodes the threads run on, and later passes with
+/// the same thread count touch mostly local memory.
+///
+/// num_threads == 0 uses one thread per hardware thread. Tables too small to fill at least two blocks are done on the
+/// calling thread. A pool is created for each call rather than kept around, so a forked process (daemon children)
+/// never waits on threads that only exist in its parent; starting the threads is cheap next to passes of this size.
+void parallel_for_blocks(uint64_t length, const std::function<void(uint64_t, uint64_t)>& func, size_t num_threads = 0);
+}  // namespace details
+
+enum class huge_pages_mode
+{
+  NONE,
+  // madvise(MADV_HUGEPAGE), served by transparent huge pages when the kernel has them enabled.
+  TRANSPARENT,
+  // MAP_HUGETLB from the reserved pool (vm.nr_hugepages), falling back to TRANSPARENT when the pool is too small.
+  EXPLICIT
+};
+
+enum class numa_policy
+{
+  NONE,
+  INTERLEAVE,
+  BIND
+};
+
+/// How the memory of a dense weight table is obtained. Only applies on Linux; elsewhere the table is always a plain
+/// allocation.
+class dense_allocation_options
+{
+public:
+  huge_pages_mode huge_pages = huge_pages_mode::NONE;
+  numa_policy numa = numa_policy::NONE;
+  // Nodes for the NUMA policy. Empty means every online node.
+  std::vector<int> numa_nodes;
+};
+
+namespace details
+{
+/// Parses a NUMA node list such as "0,2-3", the format of /sys/devices/system/node/online, into nodes. Returns false
+/// when the list is malformed.
+bool parse_numa_node_list(const std::string& list, std::vector<int>& nodes);
 }  // namespace details
 
 class dense_parameters
@@ -94,6 +152,9 @@ public:
   using const_iterator = details::dense_iterator<const VW::weight>;
 
   dense_parameters(size_t length, uint32_t stride_shift = 0);
+  /// Allocates the table as requested by allocation. Huge pages and NUMA policies that cannot be had are skipped,
+  /// which huge_pages() and numa_policy_applied() report.
+  dense_parameters(size_t length, uint32_t stride_shift, const dense_allocation_options& allocation);
   dense_parameters();
 
   dense_parameters(const dense_parameters& other) = delete;
@@ -132,6 +193,20 @@ public:
   inline VW::weight& strided_index(size_t index) { return operator[](index << _stride_shift); }
   inline const VW::weight& strided_index(size_t index) const { return operator[](index << _stride_shift); }
 
+  /// Hints the CPU to start loading the cache line of operator[](i). Does nothing on compilers without a prefetch
+  /// intrinsic.
+  inline void prefetch(size_t i) const
+  {
+    const VW::weight* w = _begin.get() + (i & _weight_mask);
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(w);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(reinterpret_cast<const char*>(w), _MM_HINT_T0);
+#else
+    (void)w;
+#endif
+  }
+
   template <typename Lambda>
   void set_default(Lambda&& default_func)
   {
@@ -146,6 +221,30 @@ public:
     }
   }
 
+  /// Same as set_default, but for initializers that depend only on the index they are given, which lets large
+  /// tables be filled on several threads. Initializers that draw from a shared random state must use set_default.
+  template <typename Lambda>
+  void set_default_by_index(Lambda&& default_func)
+  {
+    if (!not_null()) { return; }
+    parallel_for_ranges(
+        [this, &default_func](uint64_t begin, uint64_t end)
+        {
+          for (uint64_t i = begin; i < end; i++)
+          {
+            const uint64_t index = i << _stride_shift;
+            default_func(&_begin.get()[index], index);
+          }
+        });
+  }
+
+  /// Calls func(begin, end) over ranges of weight indexes without stride covering the table, on several threads for
+  /// large tables. See details::parallel_for_blocks.
+  void parallel_for_ranges(const std::function<void(uint64_t, uint64_t)>& func, size_t num_threads = 0)
+  {
+    details::parallel_for_blocks(raw_length() >> _stride_shift, func, num_threads);
+  }
+
   void set_zero(size_t offset);
 
   uint64_t mask() const { return _weight_mask; }
@@ -158,6 +257,17 @@ public:
 
   void stride_shift(uint32_t stride_shift) { _stride_shift = stride_shift; }
 
+  /// The huge pages the table actually got.
+  huge_pages_mode huge_pages() const { return _huge_pages; }
+
+  /// Whether the requested NUMA policy is in effect. Always true when none was requested.
+  bool numa_policy_applied() const { return _numa_policy_applied; }
+
+  /// How many features ahead foreach_feature and generate_interactions prefetch the weights they are about to use.
+  /// 0, the default, turns prefetching off.
+  uint32_t prefetch_distance() const { return _prefetch_distance; }
+  void prefetch_distance(uint32_t distance) { _prefetch_distance = distance; }
+
 #ifndef _WIN32
 #  ifndef DISABLE_SHARED_WEIGHTS
   void share(size_t length);
@@ -168,6 +278,11 @@ private:
   std::shared_ptr<VW::weight> _begin;
   uint64_t _weight_mask;  // (stride*(1 << num_bits) -1)
   uint32_t _stride_shift;
+  // Kept so that share() and deep_copy() allocate the same way.
+  dense_allocation_options _allocation;
+  huge_pages_mode _huge_pages = huge_pages_mode::NONE;
+  bool _numa_policy_applied = true;
+  uint32_t _prefetch_distance = 0;
 };
 }  // namespace VW
 using dense_parameters VW_DEPRECATED("dense_parameters moved into VW namespace") = VW::dense_parameters;
@@ -100,6 +100,13 @@ public:
     _default_func = default_func;
   }
 
+  // Sparse weights are defaulted one at a time as they are first accessed, so this is the same as set_default.
+  template <typename Lambda>
+  void set_default_by_index(Lambda&& default_func)
+  {
+    set_default(std::forward<Lambda>(default_func));
+  }
+
   void set_zero(size_t offset);
   uint64_t mask() const { return _weight_mask; }
 
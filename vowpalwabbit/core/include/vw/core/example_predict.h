@@ -16,6 +16,11 @@
 
 namespace VW
 {
+namespace details
+{
+class shared_interaction_cache;
+}
+
 using namespace_index = unsigned char;
 class example_predict
 {
@@ -63,6 +68,9 @@ public:
 
   // Optional
   std::vector<std::vector<extent_term>>* extent_interactions = nullptr;
+
+  // Optional. Set by shared_feature_merger on the actions of a multi_ex to reuse shared-only interaction terms.
+  details::shared_interaction_cache* shared_interactions = nullptr;
   reduction_features ex_reduction_features;
 
   // Used for debugging reductions.  Keeps track of current reduction level.
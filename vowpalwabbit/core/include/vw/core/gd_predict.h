@@ -34,6 +34,17 @@ void foreach_feature(WeightsT& /*weights*/, const VW::features& fs, DataT& dat,
 template <class DataT, void (*FuncT)(DataT&, const float feature_value, float& weight_reference), class WeightsT>
 inline void foreach_feature(WeightsT& weights, const VW::features& fs, DataT& dat, uint64_t offset = 0, float mult = 1.)
 {
+  const uint32_t distance = details::prefetch_distance(weights);
+  if (distance != 0)
+  {
+    const size_t size = fs.size();
+    for (size_t i = 0; i < size; i++)
+    {
+      if (i + distance < size) { details::prefetch_weight(weights, fs.indices[i + distance] + offset); }
+      FuncT(dat, mult * fs.values[i], weights[fs.indices[i] + offset]);
+    }
+    return;
+  }
   for (const auto& f : fs)
   {
     VW::weight& w = weights[f.index() + offset];
@@ -46,6 +57,17 @@ template <class DataT, void (*FuncT)(DataT&, float, float), class WeightsT>
 inline void foreach_feature(
     const WeightsT& weights, const VW::features& fs, DataT& dat, uint64_t offset = 0, float mult = 1.)
 {
+  const uint32_t distance = details::prefetch_distance(weights);
+  if (distance != 0)
+  {
+    const size_t size = fs.size();
+    for (size_t i = 0; i < size; i++)
+    {
+      if (i + distance < size) { details::prefetch_weight(weights, fs.indices[i + distance] + offset); }
+      FuncT(dat, mult * fs.values[i], weights.get(static_cast<size_t>(fs.indices[i] + offset)));
+    }
+    return;
+  }
   for (const auto& f : fs) { FuncT(dat, mult * f.value(), weights.get(static_cast<size_t>(f.index() + offset))); }
 }
 
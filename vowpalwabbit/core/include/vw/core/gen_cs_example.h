@@ -286,5 +286,11 @@ void cs_ldf_learn_or_predict(VW::LEARNER::learner& base, VW::multi_ex& examples,
   else { base.predict(examples, static_cast<int32_t>(id)); }
 }
 
+// Predicts with the cost-sensitive ldf learner base at offsets lo..lo+count-1 in one call. Labels are prepped and
+// restored once for the whole batch, and the action scores for offset lo+c are written to pred[c].a_s.
+void cs_ldf_multipredict(VW::LEARNER::learner& base, VW::multi_ex& examples, std::vector<VW::cb_label>& cb_labels,
+    VW::cs_label& cs_labels, std::vector<VW::cs_label>& prepped_cs_labels, uint64_t offset, size_t lo, size_t count,
+    VW::polyprediction* pred);
+
 }  // namespace details
 }  // namespace VW
@@ -14,6 +14,7 @@
 #include "vw/core/metrics_collector.h"
 #include "vw/core/multi_ex.h"
 #include "vw/core/setup_base.h"
+#include "vw/core/startup_profile.h"
 #include "vw/core/version.h"
 #include "vw/core/vw_fwd.h"
 #include "vw/io/logger.h"
@@ -179,6 +180,8 @@ public:
   bool normal_weights;
   bool tnormal_weights;
   std::string per_feature_regularizer_input;
+  VW::dense_allocation_options weight_allocation;  // set by --weights_huge_pages and --weights_numa
+  uint32_t prefetch_distance;                      // set by --weights_prefetch_distance
 };
 
 class update_rule_config
@@ -227,6 +230,8 @@ public:
   bool default_bits;
   all_reduce_type selected_all_reduce_type;
   uint32_t hash_seed;
+  size_t learner_threads = 1;  // Hogwild learner threads used by generic_driver, set by --learner_threads.
+  bool instance_threads = false;  // One thread per workspace in the multi-workspace generic_driver.
 };
 
 class runtime_state
@@ -241,6 +246,7 @@ public:
   std::unique_ptr<all_reduce_base> all_reduce;
   VW::details::generate_interactions_object_cache generate_interactions_object_cache_state;
   uint64_t parse_mask;  // 1 << num_bits -1
+  VW::details::startup_profile startup_profile;
 };
 
 class parser_runtime
@@ -369,6 +375,10 @@ namespace details
 void print_result_by_ref(
     VW::io::writer* f, float res, float weight, const VW::v_array<char>& tag, VW::io::logger& logger);
 
+// Writes the prediction as a 4-byte float in native byte order, for --predictions_format binary. The tag is not written.
+void print_packed_result_by_ref(
+    VW::io::writer* f, float res, float weight, const VW::v_array<char>& tag, VW::io::logger& logger);
+
 void compile_limits(std::vector<std::string> limits, std::array<uint32_t, VW::NUM_NAMESPACES>& dest, bool quiet,
     VW::io::logger& logger);
 }  // namespace details
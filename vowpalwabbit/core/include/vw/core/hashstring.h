@@ -19,7 +19,10 @@ VW_STD14_CONSTEXPR inline uint32_t hashall(const char* s, size_t len, uint32_t h
   return VW::uniform_hash(s, len, h);
 }
 
-VW_STD14_CONSTEXPR inline uint32_t hashstring(const char* s, size_t len, uint32_t h)
+// Strings that are plain unsigned integers (ignoring surrounding whitespace) hash to their value plus the seed,
+// everything else is passed to hash_fn.
+template <uint32_t (*hash_fn)(const char*, size_t, uint32_t)>
+VW_STD14_CONSTEXPR inline uint32_t hashstring_with(const char* s, size_t len, uint32_t h)
 {
   const char* front = s;
   while (len > 0 && front[0] <= 0x20 && static_cast<int>(front[0]) >= 0)
@@ -34,18 +37,33 @@ VW_STD14_CONSTEXPR inline uint32_t hashstring(const char* s, size_t len, uint32_
   while (p != front + len)
   {
     if (*p >= '0' && *p <= '9') { ret = 10 * ret + *(p++) - '0'; }
-    else { return VW::uniform_hash(front, len, h); }
+    else { return hash_fn(front, len, h); }
   }
 
   return ret + h;
 }
+
+VW_STD14_CONSTEXPR inline uint32_t hashstring(const char* s, size_t len, uint32_t h)
+{
+  return hashstring_with<VW::uniform_hash>(s, len, h);
+}
+
+// Counterparts of hashall and hashstring used when --hash_algorithm wyhash is selected.
+inline uint32_t hashall_wyhash(const char* s, size_t len, uint32_t h) { return VW::uniform_hash_wyhash(s, len, h); }
+
+inline uint32_t hashstring_wyhash(const char* s, size_t len, uint32_t h)
+{
+  return hashstring_with<VW::uniform_hash_wyhash>(s, len, h);
+}
 }  // namespace details
 
-// hash_func_t is always either hashall or hashstring as defined above
+// hash_func_t is always one of the hashall or hashstring variants defined above
 // so we will use a raw function pointer here instead of std::function
 using hash_func_t = uint32_t (*)(const char*, size_t, uint32_t);
 
 hash_func_t get_hasher(const std::string& s);
+// s is the --hash mode ("strings" or "all"), algorithm is the --hash_algorithm ("murmur3" or "wyhash").
+hash_func_t get_hasher(const std::string& s, const std::string& algorithm);
 
 }  // namespace VW
 using hash_func_t VW_DEPRECATED("Moved into VW namespace") = VW::hash_func_t;
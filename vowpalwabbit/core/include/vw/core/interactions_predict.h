@@ -6,15 +6,18 @@
 
 #include "vw/common/future_compat.h"
 #include "vw/common/vw_exception.h"
+#include "vw/core/array_parameters_dense.h"
 #include "vw/core/constant.h"
 #include "vw/core/example_predict.h"
 #include "vw/core/feature_group.h"
 #include "vw/core/interaction_generation_state.h"
 #include "vw/core/object_pool.h"
+#include "vw/core/shared_interaction_cache.h"
 
 #include <cstdint>
 #include <stack>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -52,6 +55,33 @@ inline void call_func_t(DataT& dat, WeightsT& /*weights*/, const float ft_value,
   FuncT(dat, ft_value, ft_idx);
 }
 
+// Prefetching the weights a loop will use a few features ahead hides the cache misses of tables much larger than the
+// last level cache. Only dense weights prefetch, and only when they have a prefetch distance set.
+template <class WeightsT>
+inline uint32_t prefetch_distance(const WeightsT& /*weights*/)
+{
+  return 0;
+}
+
+inline uint32_t prefetch_distance(const VW::dense_parameters& weights) { return weights.prefetch_distance(); }
+
+template <class WeightsT>
+inline void prefetch_weight(const WeightsT& /*weights*/, uint64_t /*ft_idx*/)
+{
+}
+
+inline void prefetch_weight(const VW::dense_parameters& weights, uint64_t ft_idx)
+{
+  weights.prefetch(static_cast<size_t>(ft_idx));
+}
+
+// Functions taking the feature index may not touch its weight, so only the weight functions get prefetches.
+template <class WeightOrIndexT, class WeightsT>
+inline uint32_t weight_prefetch_distance(const WeightsT& weights)
+{
+  return std::is_same<WeightOrIndexT, uint64_t>::value ? 0 : prefetch_distance(weights);
+}
+
 inline bool term_is_empty(VW::namespace_index term, const std::array<VW::features, VW::NUM_NAMESPACES>& feature_groups)
 {
   return feature_groups[term].empty();
@@ -218,6 +248,27 @@ void inner_kernel(DataT& dat, VW::features::const_audit_iterator& begin, VW::fea
   }
   else
   {
+    const uint32_t distance = weight_prefetch_distance<WeightOrIndexT>(weights);
+    if (distance != 0)
+    {
+      // Each row of an interaction starts cold, so the first distance weights are requested at once.
+      auto ahead = begin;
+      for (uint32_t i = 0; i < distance && ahead != end; ++i, ++ahead)
+      {
+        prefetch_weight(weights, (ahead.index() ^ halfhash) + offset);
+      }
+      for (; begin != end; ++begin)
+      {
+        if (ahead != end)
+        {
+          prefetch_weight(weights, (ahead.index() ^ halfhash) + offset);
+          ++ahead;
+        }
+        call_func_t<DataT, FuncT>(
+            dat, weights, interaction_value(ft_value, begin.value()), (begin.index() ^ halfhash) + offset);
+      }
+      return;
+    }
     for (; begin != end; ++begin)
     {
       call_func_t<DataT, FuncT>(
@@ -454,6 +505,27 @@ inline void generate_interactions(const std::vector<std::vector<VW::namespace_in
     else  // generic case: quatriples, etc.
 #endif
     {
+      // Interactions of shared namespaces only are expanded once per multi_ex, see shared_interaction_cache. Pairs
+      // and triples are not looked up, their nested loops are as cheap as replaying the stored terms.
+      if (!audit && ec.shared_interactions != nullptr)
+      {
+        const auto* terms = ec.shared_interactions->find(ns, permutations, ec.feature_space);
+        if (terms != nullptr)
+        {
+          const uint32_t distance = details::weight_prefetch_distance<WeightOrIndexT>(weights);
+          for (size_t i = 0; i < terms->size(); i++)
+          {
+            if (distance != 0 && i + distance < terms->size())
+            {
+              details::prefetch_weight(weights, (*terms)[i + distance].index + ec.ft_offset);
+            }
+            details::call_func_t<DataT, FuncT>(dat, weights, (*terms)[i].value, (*terms)[i].index + ec.ft_offset);
+          }
+          num_features += terms->size();
+          continue;
+        }
+      }
+
       // Skip over any interaction with an empty namespace.
       if (details::has_empty_interaction(ec.feature_space, ns)) { continue; }
       num_features +=
@@ -75,6 +75,10 @@ public:
     return _hash;
   }
 
+  // Model writers leave the weights out of a buffer with this set, everything else is written as usual.
+  void skip_weights(bool skip) { _skip_weights = skip; }
+  bool skips_weights() const { return _skip_weights; }
+
   void add_file(std::unique_ptr<VW::io::reader>&& file)
   {
     assert(_output_files.empty());
@@ -292,6 +296,7 @@ private:
   // used to check-sum i/o files for corruption detection
   bool _verify_hash = false;
   uint32_t _hash = 0;
+  bool _skip_weights = false;
   static constexpr size_t INITIAL_BUFF_SIZE = 1 << 16;
 
   internal_buffer _buffer;
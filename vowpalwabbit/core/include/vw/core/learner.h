@@ -64,7 +64,6 @@ std::shared_ptr<learner> require_singleline(std::shared_ptr<learner> l);
 namespace details
 {
 using void_func = std::function<void(void)>;
-using example_func = std::function<void(polymorphic_ex ex)>;
 using multipredict_func =
     std::function<void(polymorphic_ex ex, size_t count, size_t step, polyprediction* pred, bool finalize_predictions)>;
 
@@ -94,6 +93,73 @@ using add_subtract_func = std::function<void(const void* data1, const void* data
 using add_subtract_with_all_func = std::function<void(const VW::workspace& ws1, const void* data1,
     const VW::workspace& ws2, const void* data2, VW::workspace& ws_out, void* data_out)>;
 
+/// Type-erased learn, predict or update function of one learner in the stack. It holds the raw function pointer
+/// together with the data and base learner it is called with, and a thunk that casts the pointer back to its real
+/// type. The builders fill it in once when the stack is set up, so a call loads its arguments from the learner itself
+/// instead of from a heap-allocated std::function target.
+class example_dispatch
+{
+public:
+  using thunk_t = void (*)(const example_dispatch&, polymorphic_ex);
+  using erased_fn_t = void (*)();
+
+  thunk_t thunk = nullptr;
+  erased_fn_t fn = nullptr;
+  void* data = nullptr;
+  learner* base = nullptr;
+
+  void operator()(polymorphic_ex ex) const { thunk(*this, ex); }
+};
+
+template <class DataT, class ExampleT>
+void reduction_thunk(const example_dispatch& d, polymorphic_ex ex)
+{
+  reinterpret_cast<void (*)(DataT&, learner&, ExampleT&)>(d.fn)(*static_cast<DataT*>(d.data), *d.base, ex);
+}
+
+template <class ExampleT>
+void no_data_reduction_thunk(const example_dispatch& d, polymorphic_ex ex)
+{
+  reinterpret_cast<void (*)(learner&, ExampleT&)>(d.fn)(*d.base, ex);
+}
+
+template <class DataT, class ExampleT>
+void bottom_thunk(const example_dispatch& d, polymorphic_ex ex)
+{
+  reinterpret_cast<void (*)(DataT&, ExampleT&)>(d.fn)(*static_cast<DataT*>(d.data), ex);
+}
+
+template <class DataT, class ExampleT>
+example_dispatch make_reduction_dispatch(void (*fn_ptr)(DataT&, learner&, ExampleT&), DataT* data, learner* base)
+{
+  example_dispatch d;
+  d.thunk = reduction_thunk<DataT, ExampleT>;
+  d.fn = reinterpret_cast<example_dispatch::erased_fn_t>(fn_ptr);
+  d.data = data;
+  d.base = base;
+  return d;
+}
+
+template <class ExampleT>
+example_dispatch make_no_data_reduction_dispatch(void (*fn_ptr)(learner&, ExampleT&), learner* base)
+{
+  example_dispatch d;
+  d.thunk = no_data_reduction_thunk<ExampleT>;
+  d.fn = reinterpret_cast<example_dispatch::erased_fn_t>(fn_ptr);
+  d.base = base;
+  return d;
+}
+
+template <class DataT, class ExampleT>
+example_dispatch make_bottom_dispatch(void (*fn_ptr)(DataT&, ExampleT&), DataT* data)
+{
+  example_dispatch d;
+  d.thunk = bottom_thunk<DataT, ExampleT>;
+  d.fn = reinterpret_cast<example_dispatch::erased_fn_t>(fn_ptr);
+  d.data = data;
+  return d;
+}
+
 void debug_increment_depth(polymorphic_ex ex);
 void debug_decrement_depth(polymorphic_ex ex);
 void increment_offset(polymorphic_ex ex, const size_t feature_width_below, const size_t i);
@@ -121,7 +187,10 @@ void learner_build_diagnostic(VW::string_view this_name, VW::string_view base_na
 /// learner is created, the function objects are bound to the data object, and the
 /// data object is stored in a std::shared_ptr<void>. The end result is that the
 /// data type representing the learner's state is type-erased, thus allowing for
-/// arbitrary learner types to be implemented by the same learner class.
+/// arbitrary learner types to be implemented by the same learner class. The
+/// per-example learn, predict and update functions are called for every layer of
+/// the stack, so they are stored as details::example_dispatch instead of
+/// std::function.
 ///
 /// The learner class itself has a private constructor. Learners should be created
 /// only through the make_reduction_learner and make_bottom_learner functions
@@ -274,9 +343,9 @@ private:
 
   // These functions will implement the internal logic of each type of learner.
   details::void_func _init_f;
-  details::example_func _learn_f;
-  details::example_func _predict_f;
-  details::example_func _update_f;
+  details::example_dispatch _learn_f;
+  details::example_dispatch _predict_f;
+  details::example_dispatch _update_f;
   details::multipredict_func _multipredict_f;
   details::sensitivity_func _sensitivity_f;
 
@@ -566,14 +635,14 @@ public:
     assert(fn_ptr != nullptr);
     DataT* data = this->learner_data.get();
     learner* base = this->learner_ptr->get_base_learner();
-    this->learner_ptr->_predict_f = [fn_ptr, data, base](polymorphic_ex ex) { fn_ptr(*data, *base, ex); };
+    this->learner_ptr->_predict_f = details::make_reduction_dispatch(fn_ptr, data, base);
   )
 
   LEARNER_BUILDER_DEFINE(set_learn(void (*fn_ptr)(DataT&, learner&, ExampleT&)),
     assert(fn_ptr != nullptr);
     DataT* data = this->learner_data.get();
     learner* base = this->learner_ptr->get_base_learner();
-    this->learner_ptr->_learn_f = [fn_ptr, data, base](polymorphic_ex ex) { fn_ptr(*data, *base, ex); };
+    this->learner_ptr->_learn_f = details::make_reduction_dispatch(fn_ptr, data, base);
   )
 
   LEARNER_BUILDER_DEFINE(set_multipredict(void (*fn_ptr)(DataT&, learner&, ExampleT&, size_t, size_t, polyprediction*, bool)),
@@ -589,7 +658,7 @@ public:
     assert(fn_ptr != nullptr);
     DataT* data = this->learner_data.get();
     learner* base = this->learner_ptr->get_base_learner();
-    this->learner_ptr->_update_f = [fn_ptr, data, base](polymorphic_ex ex) { fn_ptr(*data, *base, ex); };
+    this->learner_ptr->_update_f = details::make_reduction_dispatch(fn_ptr, data, base);
   )
 
   // used for active learning and confidence to determine how easily predictions are changed
@@ -674,13 +743,13 @@ public:
   LEARNER_BUILDER_DEFINE(set_predict(void (*fn_ptr)(learner&, ExampleT&)),
     assert(fn_ptr != nullptr);
     learner* base = this->learner_ptr->get_base_learner();
-    this->learner_ptr->_predict_f = [fn_ptr, base](polymorphic_ex ex) { fn_ptr(*base, ex); };
+    this->learner_ptr->_predict_f = details::make_no_data_reduction_dispatch(fn_ptr, base);
   )
 
   LEARNER_BUILDER_DEFINE(set_learn(void (*fn_ptr)(learner&, ExampleT&)),
     assert(fn_ptr != nullptr);
     learner* base = this->learner_ptr->get_base_learner();
-    this->learner_ptr->_learn_f = [fn_ptr, base](polymorphic_ex ex) { fn_ptr(*base, ex); };
+    this->learner_ptr->_learn_f = details::make_no_data_reduction_dispatch(fn_ptr, base);
   )
 
   LEARNER_BUILDER_DEFINE(set_multipredict(void (*fn_ptr)(learner&, ExampleT&, size_t, size_t, polyprediction*, bool)),
@@ -694,7 +763,7 @@ public:
   LEARNER_BUILDER_DEFINE(set_update(void (*fn_ptr)(learner&, ExampleT&)),
     assert(fn_ptr != nullptr);
     learner* base = this->learner_ptr->get_base_learner();
-    this->learner_ptr->_update_f = [fn_ptr, base](polymorphic_ex ex) { fn_ptr(*base, ex); };
+    this->learner_ptr->_update_f = details::make_no_data_reduction_dispatch(fn_ptr, base);
   )
 
   // used for active learning and confidence to determine how easily predictions are changed
@@ -737,13 +806,13 @@ public:
   LEARNER_BUILDER_DEFINE(set_predict(void (*fn_ptr)(DataT&, ExampleT&)),
     assert(fn_ptr != nullptr);
     DataT* data = this->learner_data.get();
-    this->learner_ptr->_predict_f = [fn_ptr, data](polymorphic_ex ex) { fn_ptr(*data, ex); };
+    this->learner_ptr->_predict_f = details::make_bottom_dispatch(fn_ptr, data);
   )
 
   LEARNER_BUILDER_DEFINE(set_learn(void (*fn_ptr)(DataT&, ExampleT&)),
     assert(fn_ptr != nullptr);
     DataT* data = this->learner_data.get();
-    this->learner_ptr->_learn_f = [fn_ptr, data](polymorphic_ex ex) { fn_ptr(*data, ex); };
+    this->learner_ptr->_learn_f = details::make_bottom_dispatch(fn_ptr, data);
   )
 
   LEARNER_BUILDER_DEFINE(set_multipredict( void (*fn_ptr)(DataT&, ExampleT&, size_t, size_t, polyprediction*, bool)),
@@ -759,7 +828,7 @@ public:
   LEARNER_BUILDER_DEFINE(set_update(void (*fn_ptr)(DataT& data, ExampleT&)),
     assert(fn_ptr != nullptr);
     DataT* data = this->learner_data.get();
-    this->learner_ptr->_update_f = [fn_ptr, data](polymorphic_ex ex) { fn_ptr(*data, ex); };
+    this->learner_ptr->_update_f = details::make_bottom_dispatch(fn_ptr, data);
   )
 
   // used for active learning and confidence to determine how easily predictions are changed
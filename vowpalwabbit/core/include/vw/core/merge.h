@@ -8,10 +8,27 @@
 #include "vw/io/io_adapter.h"
 #include "vw/io/logger.h"
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 
 namespace VW
 {
+// How serialize_sparse encodes the changed weight values.
+enum class model_delta_value_encoding : uint8_t
+{
+  FLOAT32 = 0,  // exact
+  FLOAT16 = 1,  // IEEE half precision, about three significant digits
+  INT8 = 2      // linear quantization against a per-block, per-slot scale
+};
+
+struct model_delta_serialize_options
+{
+  model_delta_value_encoding value_encoding = model_delta_value_encoding::FLOAT32;
+  // Deflate the weight blocks and model skeleton with zlib.
+  bool compress = true;
+};
+
 class model_delta
 {
 public:
@@ -28,7 +45,12 @@ public:
   VW::workspace* unsafe_release_workspace_ptr() { return _ws.release(); }
 
   void serialize(VW::io::writer&) const;
-  // Must only load what was previously serialized with the serialize function.
+  // Writes only the weight rows with a nonzero slot as (index, values) pairs, delta coded in blocks, plus a model
+  // skeleton holding the rest of the training state. Much smaller than serialize when few weights changed.
+  // Like serialize, the optimizer state in the other weight slots is only written when the workspace saves with
+  // save_resume; otherwise only the weights themselves (slot 0) are shipped.
+  void serialize_sparse(VW::io::writer&, const model_delta_serialize_options& options = {}) const;
+  // Must only load what was previously serialized with the serialize or serialize_sparse function.
   static std::unique_ptr<model_delta> deserialize(VW::io::reader&);
 
 private:
@@ -68,6 +90,28 @@ std::unique_ptr<VW::workspace> merge_models(const VW::workspace* base_workspace,
 VW::model_delta merge_deltas(
     const std::vector<const VW::model_delta*>& deltas_to_merge, VW::io::logger* logger = nullptr);
 
+/**
+ * Merge models that are loaded one at a time. The result is the same as merge_models, but each model is folded into a
+ * single output workspace as soon as it is loaded and then released. Apart from the base workspace, at most three
+ * models are held in memory at once: the output, the model being merged and either its delta from the base or the
+ * next model, which is loaded in the background while the current one is merged. Weight rows are combined in blocks
+ * across threads.
+ *
+ * Note: This is an experimental API.
+ *
+ * @param base_workspace Optional common base model that all other models continued training from. If not supplied, then
+ * all models are assumed to be trained from scratch.
+ * @param num_models Number of models to merge, at least two.
+ * @param load_model Called once for each index in [0, num_models) to load that model. May be called from a worker
+ * thread, but never concurrently with itself.
+ * @param num_threads Number of worker threads. With zero, everything runs on the calling thread.
+ * @param logger Optional logger to be used for logging during function and is given to the resulting workspace
+ * @return std::unique_ptr<VW::workspace> Pointer to the resulting workspace.
+ */
+std::unique_ptr<VW::workspace> merge_models_streaming(const VW::workspace* base_workspace, size_t num_models,
+    const std::function<std::unique_ptr<VW::workspace>(size_t)>& load_model, size_t num_threads = 0,
+    VW::io::logger* logger = nullptr);
+
 std::unique_ptr<VW::workspace> operator+(const VW::workspace& ws, const VW::model_delta& md);
 VW::model_delta operator-(const VW::workspace& ws1, const VW::workspace& ws2);
 }  // namespace VW
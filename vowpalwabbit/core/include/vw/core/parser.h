@@ -71,6 +71,10 @@ public:
   void (*text_reader)(VW::workspace*, VW::string_view, VW::multi_ex&);
 
   hash_func_t hasher;
+  // Unconditional "all" and "strings" hashers of the selected --hash_algorithm, for names that are hashed the same
+  // way regardless of --hash.
+  hash_func_t uniform_hasher = VW::details::hashall;
+  hash_func_t string_hasher = VW::details::hashstring;
   bool resettable;  // Whether or not the input can be reset.
   io_buf output;    // Where to output the cache.
   VW::parsers::cache::details::cache_temp_buffer cache_temp_buffer_obj;
@@ -36,6 +36,8 @@ private:
   VW::workspace* _all_ptr = nullptr;
   std::shared_ptr<VW::LEARNER::learner> _base;
   size_t _feature_width_above = 1;
+  // Setup time of the reductions set up by the current setup_func call, excluded from its own time.
+  double _nested_setup_seconds = 0.0;
 
 protected:
   std::vector<std::tuple<std::string, reduction_setup_fn>> _reduction_stack;
@@ -24,6 +24,8 @@ class cb_adf
 public:
   void learn(VW::LEARNER::learner& base, VW::multi_ex& ec_seq);
   void predict(VW::LEARNER::learner& base, VW::multi_ex& ec_seq);
+  // Predicts for count consecutive offsets in one call; the ranking for offset c is written to pred[c].a_s.
+  void multipredict(VW::LEARNER::learner& base, VW::multi_ex& ec_seq, size_t count, VW::polyprediction* pred);
   bool update_statistics(const VW::example& ec, const VW::multi_ex& ec_seq, VW::shared_data& sd) const;
 
   cb_adf(VW::cb_type_t cb_type, bool rank_all, float clip_p, bool no_predict, size_t feature_width_above,
@@ -7,11 +7,12 @@
 #include "vw/common/random.h"
 #include "vw/common/string_view.h"
 #include "vw/core/feature_group.h"
+#include "vw/core/thread_pool.h"
 #include "vw/core/vw_fwd.h"
 
-#include <list>
+#include <cstdint>
+#include <future>
 #include <memory>
-#include <unordered_map>
 #include <vector>
 
 // Uncommenting this enables a timer that prints the pass time at the end of each pass.
@@ -53,10 +54,11 @@ emt_scorer_type emt_scorer_type_from_string(VW::string_view val);
 emt_router_type emt_router_type_from_string(VW::string_view val);
 emt_initial_type emt_initial_type_from_string(VW::string_view val);
 
-float emt_initial(emt_initial_type initial_type, emt_feats f1, emt_feats f2);
+float emt_initial(emt_initial_type initial_type, const emt_feats& f1, const emt_feats& f2);
 float emt_median(std::vector<float>&);
 float emt_inner(const emt_feats&, const emt_feats&);
 float emt_norm(const emt_feats&);
+float emt_distance(const emt_feats&, const emt_feats&);
 void emt_scale(emt_feats&, float);
 void emt_normalize(emt_feats&);
 emt_feats emt_scale_add(float, const emt_feats&, float, const emt_feats&);
@@ -86,30 +88,65 @@ struct emt_example
 
   emt_example() = default;
   emt_example(VW::workspace&, VW::example*);
+
+  // Overwrites this memory with the features of ex, reusing the capacity already held by base and full.
+  void fill(VW::workspace&, VW::example*, VW::features& flat_scratch);
 };
 
+// Memories and nodes live in slabs owned by emt_tree and refer to each other by slot index. This keeps routing
+// and bounding free of per-memory heap allocations and pointer chasing when the tree holds millions of memories.
+using emt_index = uint32_t;
+constexpr emt_index EMT_NULL_INDEX = UINT32_MAX;
+
+// An intrusive least-recently-used list over memory slots. The links are stored in a vector indexed by slot so
+// touching, appending and evicting a memory never allocates once the slab has grown to its working size.
 struct emt_lru
 {
-  using K = emt_example*;
-  using V = std::list<K>::iterator;
+  using K = emt_index;
+
+  struct link
+  {
+    K prev = EMT_NULL_INDEX;
+    K next = EMT_NULL_INDEX;
+    bool linked = false;
+  };
 
-  std::list<K> list;
-  std::unordered_map<K, V> map;
+  std::vector<link> links;
+  K head = EMT_NULL_INDEX;
+  K tail = EMT_NULL_INDEX;
+  uint64_t count = 0;
 
   uint64_t max_size;
 
   emt_lru(uint64_t);
+
+  // Marks item as most recently used and returns the slot that was evicted to stay within max_size, if any.
   K bound(K);
+  void erase(K);
+  uint64_t size() const { return count; }
 };
 
 struct emt_node
 {
   double router_decision = 0;
-  std::unique_ptr<emt_node> left = nullptr;
-  std::unique_ptr<emt_node> right = nullptr;
+  emt_index left = EMT_NULL_INDEX;
+  emt_index right = EMT_NULL_INDEX;
   emt_feats router_weights;
 
-  std::vector<std::unique_ptr<emt_example>> examples;
+  std::vector<emt_index> examples;  // slots in emt_tree::examples
+
+  bool is_leaf() const { return left == EMT_NULL_INDEX; }
+};
+
+// Scorer inputs comparing the query to one memory of a leaf. A whole leaf is prepared at once, optionally on
+// several threads, before the base learner scores the candidates one after another.
+struct emt_scorer_candidate
+{
+  VW::features x;  // features of the 'x' namespace of the scorer example
+  VW::features z;  // features of the 'z' namespace, only used by NOT_SELF_CONSISTENT_RANK
+  float initial = 0.f;
+  float score = 0.f;
+  bool exact_match = false;
 };
 
 struct emt_tree
@@ -131,9 +168,32 @@ struct emt_tree
   int64_t begin = 0;  // for timing performance
 #endif
 
-  std::unique_ptr<emt_node> root;
+  // node 0 is the root and children are always allocated after their parent
+  std::vector<emt_node> nodes;
+
+  // memory slab. Released slots are kept on a free list and their feature vectors keep their capacity
+  // so that refilling a slot does not allocate.
+  std::vector<emt_example> examples;
+  std::vector<emt_index> example_leaf;  // leaf node currently holding each slot
+  std::vector<emt_index> free_examples;
+
+  emt_example scratch;  // reused to hold the query during predict
+  VW::features flat_scratch;
+
   std::unique_ptr<emt_lru> bounder = nullptr;
 
+  std::vector<emt_scorer_candidate> candidates;  // one per memory of the leaf being scanned
+  emt_scorer_candidate learn_candidate;
+  // Candidates of large leaves are prepared in blocks on this pool. A pool without threads runs them inline.
+  std::unique_ptr<VW::thread_pool> scan_pool;
+  std::vector<std::future<void>> scan_futures;
+
+  emt_node& root() { return nodes[0]; }
+  const emt_node& root() const { return nodes[0]; }
+  emt_node& node(emt_index i) { return nodes[i]; }
+  const emt_node& node(emt_index i) const { return nodes[i]; }
+  size_t num_memories() const { return examples.size() - free_examples.size(); }
+
   emt_tree(VW::workspace* all, std::shared_ptr<VW::rand_state> random_state, uint32_t leaf_split,
       emt_scorer_type scorer_type, emt_router_type router_type, emt_initial_type initial_type, uint64_t tree_bound);
 };
@@ -146,9 +206,6 @@ namespace model_utils
 size_t read_model_field(io_buf& io, reductions::eigen_memory_tree::emt_example& ex);
 size_t write_model_field(
     io_buf& io, const reductions::eigen_memory_tree::emt_example& ex, const std::string& upstream_name, bool text);
-size_t read_model_field(io_buf& io, reductions::eigen_memory_tree::emt_node& node);
-size_t write_model_field(
-    io_buf& io, const reductions::eigen_memory_tree::emt_node& node, const std::string& upstream_name, bool text);
 size_t read_model_field(io_buf& io, reductions::eigen_memory_tree::emt_tree& tree);
 size_t write_model_field(
     io_buf& io, const reductions::eigen_memory_tree::emt_tree& tree, const std::string& upstream_name, bool text);
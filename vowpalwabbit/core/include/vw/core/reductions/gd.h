@@ -52,6 +52,7 @@ public:
   void (*update)(gd&, VW::example&) = nullptr;
   float (*sensitivity)(gd&, VW::example&) = nullptr;
   void (*multipredict)(gd&, VW::example&, size_t, size_t, VW::polyprediction*, bool) = nullptr;
+  std::vector<float> multipredict_scores;  // contiguous per-class scores for dense multipredict
   bool adaptive_input = false;
   bool normalized_input = false;
   bool adax = false;
@@ -0,0 +1,73 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/constant.h"
+#include "vw/core/feature_group.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace VW
+{
+class example;
+
+namespace details
+{
+/// Expanded interaction terms of a multi_ex's shared example, reused by every action of that multi_ex.
+///
+/// shared_feature_merger copies the shared namespaces into each action, so an interaction made only of shared
+/// namespaces expands to the same terms for every action and for every learn/predict pass over it. The first
+/// generate_interactions call that needs such an interaction expands it from the shared example and stores each term
+/// as (index without ft_offset, value). Later calls replay the stored terms, which gives the same indices, values and
+/// order as expanding them again.
+///
+/// An interaction is only served from the cache when, for every namespace in it, the action's feature group is
+/// exactly the shared example's group, i.e. the action has no features of its own there. generate_interactions only
+/// consults the cache for interactions of four or more namespaces, which go through the generic expansion; extent
+/// interactions and audit runs always expand normally. reset() invalidates everything and is called for each new
+/// multi_ex.
+class shared_interaction_cache
+{
+public:
+  class term
+  {
+  public:
+    uint64_t index;
+    float value;
+  };
+
+  // Interactions expanding to more terms than this are not stored.
+  static constexpr size_t MAX_TERMS = 1 << 20;
+
+  /// Drops all expansions and starts caching for a new shared example.
+  void reset(const VW::example* shared);
+
+  /// Returns the cached terms for the interaction, or nullptr when it must be expanded normally for this action.
+  const std::vector<term>* find(const std::vector<VW::namespace_index>& interaction, bool permutations,
+      const std::array<VW::features, VW::NUM_NAMESPACES>& action_feature_space);
+
+  size_t size() const { return _num_used; }
+
+private:
+  class entry
+  {
+  public:
+    std::vector<VW::namespace_index> interaction;
+    bool permutations = false;
+    bool cacheable = false;
+    std::vector<term> terms;
+  };
+
+  const VW::example* _shared = nullptr;
+  // Entries past _num_used keep their allocations for the next multi_ex.
+  std::vector<entry> _entries;
+  size_t _num_used = 0;
+  size_t _total_terms = 0;
+};
+}  // namespace details
+}  // namespace VW
@@ -0,0 +1,53 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace VW
+{
+namespace details
+{
+/// Wall-clock time spent in the phases of VW::initialize and in the setup function of each reduction.
+///
+/// The phases are recorded back to back: end_phase() charges everything since the previous phase ended to the named
+/// phase. Reduction times exclude the time spent setting up the reductions below them, so the reduction entries add
+/// up to the setup_reductions phase. Recording is always on since it costs a few clock reads; --startup_profile prints
+/// the result once initialization is done.
+class startup_profile
+{
+public:
+  using clock = std::chrono::steady_clock;
+  static constexpr double MIN_LISTED_SECONDS = 1e-4;
+
+  class entry
+  {
+  public:
+    std::string name;
+    double seconds;
+  };
+
+  /// Starts the first phase at the given time.
+  void start(clock::time_point start_time);
+
+  /// Records the time since the previous phase ended as the named phase.
+  void end_phase(const std::string& name);
+
+  void add_reduction(const std::string& name, double seconds);
+
+  /// Formats the phases and reductions as a table, slowest reductions first. Reductions that took less than
+  /// MIN_LISTED_SECONDS, usually the ones that only registered their options, are summed into one line.
+  std::string to_string() const;
+
+  std::vector<entry> phases;
+  std::vector<entry> reductions;
+
+private:
+  clock::time_point _phase_start;
+};
+}  // namespace details
+}  // namespace VW
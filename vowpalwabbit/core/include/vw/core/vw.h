@@ -132,6 +132,16 @@ std::unique_ptr<VW::workspace> seed_vw_model(VW::workspace& vw_model, const std:
     driver_output_func_t driver_output_func = nullptr, void* driver_output_func_context = nullptr,
     VW::io::logger* custom_logger = nullptr);
 
+/// Creates an independent copy of a workspace. Learner state other than the weights goes through
+/// save_predictor and loading, as a saved model would. The weights are copied directly instead of going
+/// through the model format, so the cost of cloning a large model is a single memcpy of its weights.
+/// Every weight slot is copied as is, including adaptive and normalized state, so the weights match a
+/// --save_resume round trip even when the source was set up with --predict_only_model.
+/// Unlike seed_vw_model nothing is shared, so both workspaces can keep learning independently.
+/// \param ws the workspace to clone, it is not modified
+/// \param custom_logger logger for the new workspace, if null the new workspace is quiet
+std::unique_ptr<VW::workspace> clone_workspace(const VW::workspace& ws, VW::io::logger* custom_logger = nullptr);
+
 VW_WARNING_STATE_PUSH
 VW_WARNING_DISABLE_BADLY_FORMED_XML
 /**
@@ -284,9 +294,11 @@ inline uint64_t hash_space(VW::workspace& all, const std::string& s)
 {
   return all.parser_runtime.example_parser->hasher(s.data(), s.length(), all.runtime_config.hash_seed);
 }
-inline uint64_t hash_space_static(const std::string& s, const std::string& hash)
+// algorithm is the --hash_algorithm of the model the hash is meant for.
+inline uint64_t hash_space_static(
+    const std::string& s, const std::string& hash, const std::string& algorithm = "murmur3")
 {
-  return get_hasher(hash)(s.data(), s.length(), 0);
+  return get_hasher(hash, algorithm)(s.data(), s.length(), 0);
 }
 inline uint64_t hash_space_cstr(VW::workspace& all, const char* fstr)
 {
@@ -297,10 +309,11 @@ inline uint64_t hash_feature(VW::workspace& all, const std::string& s, uint64_t
 {
   return all.parser_runtime.example_parser->hasher(s.data(), s.length(), u) & all.runtime_state.parse_mask;
 }
-inline uint64_t hash_feature_static(const std::string& s, uint64_t u, const std::string& h, uint32_t num_bits)
+inline uint64_t hash_feature_static(const std::string& s, uint64_t u, const std::string& h, uint32_t num_bits,
+    const std::string& algorithm = "murmur3")
 {
   size_t parse_mark = (1 << num_bits) - 1;
-  return get_hasher(h)(s.data(), s.length(), u) & parse_mark;
+  return get_hasher(h, algorithm)(s.data(), s.length(), u) & parse_mark;
 }
 
 inline uint64_t hash_feature_cstr(VW::workspace& all, const char* fstr, uint64_t u)
@@ -4,27 +4,248 @@
 
 #include "vw/core/array_parameters_dense.h"
 
+#include "vw/common/future_compat.h"
+#include "vw/common/vw_throw.h"
 #include "vw/core/memory.h"
+#include "vw/core/thread_pool.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <future>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 #ifndef _WIN32
 #  include <sys/mman.h>
 #endif
 
+#ifdef __linux__
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
 // It appears that on OSX MAP_ANONYMOUS is mapped to MAP_ANON
 // https://github.com/leftmike/foment/issues/4
 #ifdef __APPLE__
 #  define MAP_ANONYMOUS MAP_ANON
 #endif
 
+namespace
+{
+// Tables of at least this many bytes are mapped directly from the kernel. Anonymous mappings are zero-filled page by
+// page when first touched, so the table is not written in full up front and pages that are never used stay unbacked.
+// For the multi-gigabyte tables of large -b this is most of the cost of creating a workspace.
+constexpr size_t MIN_MAPPED_BYTES = static_cast<size_t>(1) << 24;
+
+// Default size of the pages MAP_HUGETLB hands out on x86-64 and arm64. Explicit huge page mappings are rounded up to
+// a multiple of it.
+constexpr size_t EXPLICIT_HUGE_PAGE_BYTES = static_cast<size_t>(1) << 21;
+
+class weights_allocation
+{
+public:
+  std::shared_ptr<VW::weight> data;
+  VW::huge_pages_mode huge_pages = VW::huge_pages_mode::NONE;
+  bool numa_policy_applied = true;
+};
+
+#if defined(__linux__) && defined(SYS_mbind)
+// mbind modes from <linux/mempolicy.h>, which is not installed everywhere this builds.
+constexpr int MPOL_BIND_MODE = 2;
+constexpr int MPOL_INTERLEAVE_MODE = 3;
+
+std::vector<int> online_numa_nodes()
+{
+  std::ifstream file("/sys/devices/system/node/online");
+  std::string list;
+  std::vector<int> nodes;
+  if (!std::getline(file, list) || !VW::details::parse_numa_node_list(list, nodes)) { return {}; }
+  return nodes;
+}
+#endif
+
+// Must run before the pages are first touched, since the policy only decides where new pages are placed.
+bool apply_numa_policy(void* data, size_t length, const VW::dense_allocation_options& allocation)
+{
+  if (allocation.numa == VW::numa_policy::NONE) { return true; }
+#if defined(__linux__) && defined(SYS_mbind)
+  const auto nodes = allocation.numa_nodes.empty() ? online_numa_nodes() : allocation.numa_nodes;
+  if (nodes.empty()) { return false; }
+  constexpr size_t BITS_PER_WORD = sizeof(unsigned long) * 8;
+  const auto max_node = static_cast<size_t>(*std::max_element(nodes.begin(), nodes.end()));
+  std::vector<unsigned long> mask(max_node / BITS_PER_WORD + 1);
+  for (int node : nodes) { mask[node / BITS_PER_WORD] |= 1UL << (node % BITS_PER_WORD); }
+  const int mode = allocation.numa == VW::numa_policy::INTERLEAVE ? MPOL_INTERLEAVE_MODE : MPOL_BIND_MODE;
+  // The kernel reads one bit less than maxnode says.
+  return syscall(SYS_mbind, data, length, mode, mask.data(), mask.size() * BITS_PER_WORD + 1, 0) == 0;
+#else
+  _UNUSED(data);
+  _UNUSED(length);
+  return false;
+#endif
+}
+
+#ifndef _WIN32
+// Maps length bytes of zeroed memory as the allocation options ask. data is null when the mapping fails.
+weights_allocation map_weights(size_t length, const VW::dense_allocation_options& allocation, bool shared)
+{
+  weights_allocation result;
+  const int visibility = shared ? MAP_SHARED : MAP_PRIVATE;
+  void* data = MAP_FAILED;
+  size_t mapped_length = length;
+#  ifdef MAP_HUGETLB
+  if (allocation.huge_pages == VW::huge_pages_mode::EXPLICIT)
+  {
+    mapped_length = (length + EXPLICIT_HUGE_PAGE_BYTES - 1) / EXPLICIT_HUGE_PAGE_BYTES * EXPLICIT_HUGE_PAGE_BYTES;
+    data = mmap(nullptr, mapped_length, PROT_READ | PROT_WRITE, visibility | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (data != MAP_FAILED) { result.huge_pages = VW::huge_pages_mode::EXPLICIT; }
+  }
+#  endif
+  if (data == MAP_FAILED)
+  {
+    mapped_length = length;
+    data = mmap(nullptr, mapped_length, PROT_READ | PROT_WRITE, visibility | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED) { return result; }
+#  ifdef MADV_HUGEPAGE
+    if (allocation.huge_pages != VW::huge_pages_mode::NONE && 0 == madvise(data, mapped_length, MADV_HUGEPAGE))
+    {
+      result.huge_pages = VW::huge_pages_mode::TRANSPARENT;
+    }
+#  endif
+#  ifdef MADV_MERGEABLE
+    // Same as calloc_mergable_or_throw, mark the table as KSM sharable. KSM splits huge pages back up, and only
+    // private mappings can be merged, so it is skipped for those.
+    if (allocation.huge_pages == VW::huge_pages_mode::NONE && !shared &&
+        0 != madvise(data, mapped_length, MADV_MERGEABLE))
+    {
+      const char* msg = "internal warning: marking memory as ksm mergeable failed!\n";
+      fputs(msg, stderr);
+    }
+#  endif
+  }
+  result.numa_policy_applied = apply_numa_policy(data, mapped_length, allocation);
+  result.data = std::shared_ptr<VW::weight>(
+      static_cast<VW::weight*>(data), [mapped_length](VW::weight* weights) { munmap(weights, mapped_length); });
+  return result;
+}
+#endif
+
+weights_allocation allocate_zeroed_weights(size_t float_count, const VW::dense_allocation_options& allocation)
+{
+#ifndef _WIN32
+  const size_t length = float_count * sizeof(VW::weight);
+  const bool special = allocation.huge_pages != VW::huge_pages_mode::NONE || allocation.numa != VW::numa_policy::NONE;
+  if (length > 0 && (length >= MIN_MAPPED_BYTES || special))
+  {
+    auto result = map_weights(length, allocation, false);
+    if (result.data != nullptr) { return result; }
+  }
+#endif
+  weights_allocation result;
+  // memory allocated by calloc should be freed by C free()
+  result.data = std::shared_ptr<VW::weight>(VW::details::calloc_mergable_or_throw<VW::weight>(float_count), free);
+  result.numa_policy_applied = allocation.numa == VW::numa_policy::NONE;
+  return result;
+}
+
+bool parse_numa_node(const std::string& text, int& node)
+{
+  constexpr int MAX_NUMA_NODE = 1023;
+  if (text.empty() || text.size() > 4 || text.find_first_not_of("0123456789") != std::string::npos) { return false; }
+  node = std::stoi(text);
+  return node <= MAX_NUMA_NODE;
+}
+}  // namespace
+
+bool VW::details::parse_numa_node_list(const std::string& list, std::vector<int>& nodes)
+{
+  nodes.clear();
+  std::stringstream stream(list);
+  std::string item;
+  while (std::getline(stream, item, ','))
+  {
+    const auto dash = item.find('-');
+    int first = 0;
+    int last = 0;
+    if (!parse_numa_node(item.substr(0, dash), first)) { return false; }
+    if (dash == std::string::npos) { last = first; }
+    else if (!parse_numa_node(item.substr(dash + 1), last) || last < first) { return false; }
+    for (int node = first; node <= last; node++) { nodes.push_back(node); }
+  }
+  // getline does not report an empty item after a trailing comma.
+  return !nodes.empty() && list.back() != ',';
+}
+
+void VW::details::parallel_for_blocks(
+    uint64_t length, const std::function<void(uint64_t, uint64_t)>& func, size_t num_threads)
+{
+  if (num_threads == 0) { num_threads = std::max(1u, std::thread::hardware_concurrency()); }
+  const uint64_t num_blocks = (length + PARALLEL_BLOCK_SIZE - 1) / PARALLEL_BLOCK_SIZE;
+  if (num_blocks == 0) { return; }
+  const uint64_t num_runs = std::min(static_cast<uint64_t>(num_threads), num_blocks);
+
+  // Runs the blocks of run r, blocks [r * num_blocks / num_runs, (r + 1) * num_blocks / num_runs).
+  auto run_blocks = [&func, length, num_blocks, num_runs](uint64_t r)
+  {
+    const uint64_t first_block = r * num_blocks / num_runs;
+    const uint64_t last_block = (r + 1) * num_blocks / num_runs;
+    for (uint64_t b = first_block; b < last_block; b++)
+    {
+      func(b * PARALLEL_BLOCK_SIZE, std::min(length, (b + 1) * PARALLEL_BLOCK_SIZE));
+    }
+  };
+
+  if (num_runs == 1)
+  {
+    run_blocks(0);
+    return;
+  }
+
+  VW::thread_pool pool(num_runs - 1);
+  std::vector<std::future<void>> futures;
+  for (uint64_t r = 1; r < num_runs; r++) { futures.push_back(pool.submit(run_blocks, r)); }
+  std::exception_ptr error;
+  try
+  {
+    run_blocks(0);
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
+  for (auto& future : futures)
+  {
+    try
+    {
+      future.get();
+    }
+    catch (...)
+    {
+      if (error == nullptr) { error = std::current_exception(); }
+    }
+  }
+  if (error != nullptr) { std::rethrow_exception(error); }
+}
+
 VW::dense_parameters::dense_parameters(size_t length, uint32_t stride_shift)
-    // memory allocated by calloc should be freed by C free()
-    : _begin(VW::details::calloc_mergable_or_throw<VW::weight>(length << stride_shift), free)
-    , _weight_mask((length << stride_shift) - 1)
-    , _stride_shift(stride_shift)
+    : dense_parameters(length, stride_shift, dense_allocation_options{})
+{
+}
+
+VW::dense_parameters::dense_parameters(
+    size_t length, uint32_t stride_shift, const dense_allocation_options& allocation)
+    : _weight_mask((length << stride_shift) - 1), _stride_shift(stride_shift), _allocation(allocation)
 {
+  auto result = allocate_zeroed_weights(length << stride_shift, allocation);
+  _begin = std::move(result.data);
+  _huge_pages = result.huge_pages;
+  _numa_policy_applied = result.numa_policy_applied;
 }
 
 VW::dense_parameters::dense_parameters() : _begin(nullptr), _weight_mask(0), _stride_shift(0) {}
@@ -34,6 +255,10 @@ VW::dense_parameters& VW::dense_parameters::operator=(dense_parameters&& other)
   _begin = std::move(other._begin);
   _weight_mask = other._weight_mask;
   _stride_shift = other._stride_shift;
+  _allocation = std::move(other._allocation);
+  _huge_pages = other._huge_pages;
+  _numa_policy_applied = other._numa_policy_applied;
+  _prefetch_distance = other._prefetch_distance;
   return *this;
 }
 
@@ -42,6 +267,10 @@ VW::dense_parameters::dense_parameters(dense_parameters&& other) noexcept
   _begin = std::move(other._begin);
   _weight_mask = other._weight_mask;
   _stride_shift = other._stride_shift;
+  _allocation = std::move(other._allocation);
+  _huge_pages = other._huge_pages;
+  _numa_policy_applied = other._numa_policy_applied;
+  _prefetch_distance = other._prefetch_distance;
 }
 bool VW::dense_parameters::not_null() { return (_weight_mask > 0 && _begin != nullptr); }
 
@@ -51,6 +280,10 @@ VW::dense_parameters VW::dense_parameters::shallow_copy(const dense_parameters&
   return_val._begin = input._begin;
   return_val._weight_mask = input._weight_mask;
   return_val._stride_shift = input._stride_shift;
+  return_val._allocation = input._allocation;
+  return_val._huge_pages = input._huge_pages;
+  return_val._numa_policy_applied = input._numa_policy_applied;
+  return_val._prefetch_distance = input._prefetch_distance;
   return return_val;
 }
 
@@ -58,9 +291,14 @@ VW::dense_parameters VW::dense_parameters::deep_copy(const dense_parameters& inp
 {
   dense_parameters return_val;
   auto length = input._weight_mask + 1;
-  return_val._begin.reset(VW::details::calloc_mergable_or_throw<VW::weight>(length), free);
+  auto result = allocate_zeroed_weights(length, input._allocation);
+  return_val._begin = std::move(result.data);
   return_val._weight_mask = input._weight_mask;
   return_val._stride_shift = input._stride_shift;
+  return_val._allocation = input._allocation;
+  return_val._huge_pages = result.huge_pages;
+  return_val._numa_policy_applied = result.numa_policy_applied;
+  return_val._prefetch_distance = input._prefetch_distance;
   std::memcpy(return_val._begin.get(), input._begin.get(), length * sizeof(VW::weight));
   return return_val;
 }
@@ -69,7 +307,13 @@ void VW::dense_parameters::set_zero(size_t offset)
 {
   if (not_null())
   {
-    for (iterator iter = begin(); iter != end(); ++iter) { (&(*iter))[offset] = 0; }
+    VW::weight* weights = _begin.get();
+    const uint32_t stride_shift = _stride_shift;
+    parallel_for_ranges(
+        [weights, stride_shift, offset](uint64_t begin, uint64_t end)
+        {
+          for (uint64_t i = begin; i < end; i++) { weights[(i << stride_shift) + offset] = 0; }
+        });
   }
 }
 
@@ -77,13 +321,13 @@ void VW::dense_parameters::set_zero(size_t offset)
 #  ifndef DISABLE_SHARED_WEIGHTS
 void VW::dense_parameters::share(size_t length)
 {
-  VW::weight* shared_weights = static_cast<VW::weight*>(mmap(nullptr, (length << _stride_shift) * sizeof(VW::weight),
-      PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0));
-  size_t float_count = length << _stride_shift;
-  std::shared_ptr<VW::weight> dest(
-      shared_weights, [shared_weights, float_count](void*) { munmap(shared_weights, float_count); });
-  memcpy(dest.get(), _begin.get(), float_count * sizeof(VW::weight));
-  _begin = dest;
+  const size_t float_count = length << _stride_shift;
+  auto result = map_weights(float_count * sizeof(VW::weight), _allocation, true);
+  if (result.data == nullptr) { THROW_OR_RETURN_VOID("Failed to map " << float_count << " shared weights"); }
+  memcpy(result.data.get(), _begin.get(), float_count * sizeof(VW::weight));
+  _begin = std::move(result.data);
+  _huge_pages = result.huge_pages;
+  _numa_policy_applied = result.numa_policy_applied;
 }
 #  endif
 #endif
@@ -55,7 +55,7 @@ void VW::details::binary_print_result_by_ref(
 void VW::details::get_prediction(VW::io::reader* f, float& res, float& weight)
 {
   global_prediction p{};
-  really_read(f, &p, sizeof(p));
+  if (really_read(f, &p, sizeof(p)) < sizeof(p)) { THROW("connection closed while waiting for a prediction"); }
   res = p.p;
   weight = p.weight;
 }
\ No newline at end of file
@@ -29,6 +29,7 @@
 #include "vw/core/vw_allreduce.h"
 #include "vw/io/logger.h"
 
+#include <fmt/format.h>
 #include <rapidjson/document.h>
 #include <rapidjson/rapidjson.h>
 #include <rapidjson/stringbuffer.h>
@@ -53,29 +54,47 @@ void VW::details::print_result_by_ref(
 {
   if (f != nullptr)
   {
-    std::stringstream ss;
-    auto saved_precision = ss.precision();
-    if (floorf(res) == res) { ss << std::setprecision(0); }
-    ss << std::fixed << res << std::setprecision(saved_precision);
-    if (!tag.empty()) { ss << " " << VW::string_view{tag.begin(), tag.size()}; }
-    ss << '\n';
-    ssize_t len = ss.str().size();
-    ssize_t t = f->write(ss.str().c_str(), static_cast<unsigned int>(len));
+    // Formats the same text as std::fixed with the default precision, or no decimals for whole numbers.
+    fmt::memory_buffer buffer;
+    if (floorf(res) == res) { fmt::format_to(std::back_inserter(buffer), "{:.0f}", res); }
+    else { fmt::format_to(std::back_inserter(buffer), "{:.6f}", res); }
+    if (!tag.empty())
+    {
+      buffer.push_back(' ');
+      buffer.append(tag.begin(), tag.end());
+    }
+    buffer.push_back('\n');
+    ssize_t len = buffer.size();
+    ssize_t t = f->write(buffer.data(), static_cast<unsigned int>(len));
     if (t != len) { logger.err_error("write error: {}", VW::io::strerror_to_string(errno)); }
   }
 }
 
+void VW::details::print_packed_result_by_ref(
+    VW::io::writer* f, float res, float, const VW::v_array<char>&, VW::io::logger& logger)
+{
+  if (f != nullptr)
+  {
+    ssize_t t = f->write(reinterpret_cast<const char*>(&res), sizeof(res));
+    if (t != sizeof(res)) { logger.err_error("write error: {}", VW::io::strerror_to_string(errno)); }
+  }
+}
+
 void print_raw_text_by_ref(
     VW::io::writer* f, const std::string& s, const VW::v_array<char>& tag, VW::io::logger& logger)
 {
   if (f == nullptr) { return; }
 
-  std::stringstream ss;
-  ss << s;
-  if (!tag.empty()) { ss << " " << VW::string_view{tag.begin(), tag.size()}; }
-  ss << '\n';
-  ssize_t len = ss.str().size();
-  ssize_t t = f->write(ss.str().c_str(), static_cast<unsigned int>(len));
+  fmt::memory_buffer buffer;
+  buffer.append(s.data(), s.data() + s.size());
+  if (!tag.empty())
+  {
+    buffer.push_back(' ');
+    buffer.append(tag.begin(), tag.end());
+  }
+  buffer.push_back('\n');
+  ssize_t len = buffer.size();
+  ssize_t t = f->write(buffer.data(), static_cast<unsigned int>(len));
   if (t != len) { logger.err_error("write error: {}", VW::io::strerror_to_string(errno)); }
 }
 
@@ -361,6 +380,7 @@ workspace::workspace(VW::io::logger logger) : options(nullptr, nullptr), logger(
   initial_weights_config.normal_weights = false;
   initial_weights_config.tnormal_weights = false;
   initial_weights_config.per_feature_regularizer_input = "";
+  initial_weights_config.prefetch_distance = 0;
   output_model_config.per_feature_regularizer_output = "";
   output_model_config.per_feature_regularizer_text = "";
 
@@ -18,3 +18,17 @@ VW::hash_func_t VW::get_hasher(const std::string& s)
   else
     THROW("Unknown hash function: " << s);
 }
+
+VW::hash_func_t VW::get_hasher(const std::string& s, const std::string& algorithm)
+{
+  if (algorithm == "murmur3") { return VW::get_hasher(s); }
+  else if (algorithm == "wyhash")
+  {
+    if (s == "strings") { return VW::details::hashstring_wyhash; }
+    else if (s == "all") { return VW::details::hashall_wyhash; }
+    else
+      THROW("Unknown hash function: " << s);
+  }
+  else
+    THROW("Unknown hash algorithm: " << algorithm);
+}
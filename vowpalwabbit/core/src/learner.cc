@@ -19,12 +19,29 @@
 
 #include "vw/core/vw_string_view_fmt.h"
 
+#include "vw/config/cli_options_serializer.h"
+#include "vw/config/options_cli.h"
+#include "vw/core/best_constant.h"
 #include "vw/core/parse_dispatch_loop.h"
+#include "vw/core/parse_primitives.h"
 #include "vw/core/parse_regressor.h"
 #include "vw/core/parser.h"
+#include "vw/core/queue.h"
 #include "vw/core/reductions/conditional_contextual_bandit.h"
+#include "vw/core/reductions/gd.h"
+#include "vw/core/scope_exit.h"
+#include "vw/core/shared_data.h"
 #include "vw/core/vw.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <set>
+#include <thread>
+
 namespace VW
 {
 namespace LEARNER
@@ -290,8 +307,365 @@ void generic_driver(ready_examples_queue& examples, context_type& context)
   drain_examples(context.get_master());
 }
 
+// Workspace for one --learner_threads thread. Like VW::seed_vw_model it shares the master's weights and has its own
+// learner stack, but the input, output, logging and pass options stay with the master. It starts from a copy of the
+// master's shared_data, which the driver keeps in step with the master's under the finish lock.
+std::unique_ptr<VW::workspace> make_learner_thread_workspace(VW::workspace& master)
+{
+  std::set<std::string> master_only_options = {"initial_regressor", "passes"};
+  for (const auto& group : master.options->get_all_option_group_definitions())
+  {
+    if (group.m_name == "Input Options" || group.m_name == "Prediction Output Options" ||
+        group.m_name == "Output Model Options" || group.m_name == "Logging Options" ||
+        group.m_name == "Diagnostic Options" || group.m_name == "Parallelization Options")
+    {
+      for (const auto& option : group.m_options) { master_only_options.insert(option->m_name); }
+    }
+  }
+
+  config::cli_options_serializer serializer;
+  for (const auto& option : master.options->get_all_options())
+  {
+    if (master.options->was_supplied(option->m_name) && master_only_options.count(option->m_name) == 0)
+    {
+      serializer.add(*option);
+    }
+  }
+  auto args = VW::split_command_line(serializer.str());
+  args.emplace_back("--quiet");
+  args.emplace_back("--no_stdin");
+
+  auto worker = VW::initialize(VW::make_unique<config::options_cli>(args));
+  worker->weights.shallow_copy(master.weights);
+  worker->sd = std::make_shared<VW::shared_data>(*master.sd);
+  worker->update_rule_config.eta = master.update_rule_config.eta;
+  return worker;
+}
+
+VW::reductions::gd& get_gd_data(VW::workspace& all)
+{
+  return *static_cast<VW::reductions::gd*>(
+      all.l->get_learner_by_name_prefix("gd")->get_internal_type_erased_data_pointer_test_use_only());
+}
+
+// Hogwild driver for --learner_threads. The calling thread reads the master's parser and queues the examples. Each
+// learner thread learns them through its own workspace, updating the shared dense weights without locks. Finishing an
+// example (stats, predictions, progress and returning it to the pool) happens on the master under a lock, so the
+// output is the same as with one thread apart from ordering. End of pass and save examples wait until every queued
+// example has been learned and then run on the master alone.
+class learner_threads_driver
+{
+public:
+  static constexpr size_t QUEUE_SIZE_PER_THREAD = 16;
+
+  learner_threads_driver(VW::workspace& master)
+      : _master(master), _queue(master.runtime_config.learner_threads * QUEUE_SIZE_PER_THREAD)
+  {
+  }
+
+  void run()
+  {
+    for (size_t i = 0; i < _master.runtime_config.learner_threads; i++)
+    {
+      _workers.push_back(make_learner_thread_workspace(_master));
+    }
+    std::vector<std::thread> threads;
+    auto join_guard = VW::scope_exit(
+        [this, &threads]
+        {
+          _queue.set_done();
+          for (auto& t : threads) { t.join(); }
+        });
+    // Workers start from the master's normalization totals, which are nonzero when resuming a model with -i.
+    _initial_gd_states = get_gd_data(_master).gd_per_model_states;
+    for (auto& worker : _workers) { get_gd_data(*worker).gd_per_model_states = _initial_gd_states; }
+    for (auto& worker : _workers) { threads.emplace_back(&learner_threads_driver::learn_loop, this, worker.get()); }
+
+    ready_examples_queue examples(_master);
+    example* ec;
+    while (!failed() && (ec = examples.pop()) != nullptr) { on_example(ec); }
+
+    join_guard.call();
+    if (_exception) { std::rethrow_exception(_exception); }
+
+    for (auto& worker : _workers) { worker->l->end_examples(); }
+    sync_gd_states();
+    drain_examples(_master);
+  }
+
+private:
+  // Each learner thread's gd adds the normalization totals of the examples it learned to the totals it started with.
+  // The master, which is the workspace that saves the model, gets the starting totals plus what every thread added,
+  // so a saved model resumes as if one thread had learned everything. Only called while the learner threads are idle.
+  void sync_gd_states()
+  {
+    auto& master_states = get_gd_data(_master).gd_per_model_states;
+    master_states = _initial_gd_states;
+    for (auto& worker : _workers)
+    {
+      const auto& worker_states = get_gd_data(*worker).gd_per_model_states;
+      for (size_t i = 0; i < master_states.size(); i++)
+      {
+        master_states[i].normalized_sum_norm_x +=
+            worker_states[i].normalized_sum_norm_x - _initial_gd_states[i].normalized_sum_norm_x;
+        master_states[i].total_weight += worker_states[i].total_weight - _initial_gd_states[i].total_weight;
+      }
+    }
+  }
+
+  void on_example(example* ec)
+  {
+    // Same dispatch as single_example_handler.
+    if (ec->indices.size() > 1 || !(ec->end_pass || is_save_cmd(ec) || ec->is_newline)) { enqueue(ec); }
+    else if (ec->end_pass)
+    {
+      wait_until_idle();
+      sync_gd_states();
+      end_pass(*ec, _master);
+      for (auto& worker : _workers)
+      {
+        worker->passes_config.current_pass = _master.passes_config.current_pass;
+        worker->update_rule_config.eta = _master.update_rule_config.eta;
+      }
+    }
+    else if (is_save_cmd(ec))
+    {
+      wait_until_idle();
+      sync_gd_states();
+      save(*ec, _master);
+    }
+    else
+    {
+      std::lock_guard<std::mutex> lock(_finish_mutex);
+      VW::finish_example(_master, *ec);
+    }
+  }
+
+  void enqueue(example* ec)
+  {
+    {
+      std::lock_guard<std::mutex> lock(_in_flight_mutex);
+      ++_in_flight;
+    }
+    _queue.push(ec);
+  }
+
+  void wait_until_idle()
+  {
+    std::unique_lock<std::mutex> lock(_in_flight_mutex);
+    _idle.wait(lock, [this] { return _in_flight == 0; });
+  }
+
+  bool failed() const { return _failed.load(std::memory_order_relaxed); }
+
+  // Keeps the first exception for the master to rethrow.
+  void record_failure()
+  {
+    std::lock_guard<std::mutex> lock(_in_flight_mutex);
+    if (_exception == nullptr) { _exception = std::current_exception(); }
+    _failed = true;
+  }
+
+  // Learning records the label range and the observed labels in the worker's shared_data, while the example counts
+  // that gd's learning rate reads are only updated by finishing on the master. Called under the finish lock after
+  // each example: the labels go into the master's shared_data, which reports and is saved, and the worker picks up
+  // the master's label range and counts.
+  void exchange_shared_data(VW::shared_data& worker_sd)
+  {
+    auto& master_sd = *_master.sd;
+    master_sd.min_label = std::min(master_sd.min_label, worker_sd.min_label);
+    master_sd.max_label = std::max(master_sd.max_label, worker_sd.max_label);
+    for (float label : {worker_sd.first_observed_label, worker_sd.second_observed_label})
+    {
+      if (label != FLT_MAX) { VW::count_label(master_sd, label); }
+    }
+    if (worker_sd.is_more_than_two_labels_observed) { master_sd.is_more_than_two_labels_observed = true; }
+
+    worker_sd.min_label = master_sd.min_label;
+    worker_sd.max_label = master_sd.max_label;
+    worker_sd.t = master_sd.t;
+    worker_sd.weighted_holdout_examples = master_sd.weighted_holdout_examples;
+    worker_sd.weighted_unlabeled_examples = master_sd.weighted_unlabeled_examples;
+  }
+
+  void learn_loop(VW::workspace* worker)
+  {
+    example* ec;
+    while (_queue.try_pop(ec))
+    {
+      // After a failure the remaining examples are only finished so that the master can stop. The example that
+      // failed is finished as well, which returns it to the pool.
+      try
+      {
+        if (!failed()) { worker->learn(*ec); }
+      }
+      catch (...)
+      {
+        record_failure();
+      }
+      try
+      {
+        std::lock_guard<std::mutex> lock(_finish_mutex);
+        require_singleline(_master.l)->finish_example(_master, *ec);
+        exchange_shared_data(*worker->sd);
+      }
+      catch (...)
+      {
+        record_failure();
+      }
+      std::lock_guard<std::mutex> lock(_in_flight_mutex);
+      if (--_in_flight == 0) { _idle.notify_all(); }
+    }
+  }
+
+  VW::workspace& _master;
+  std::vector<std::unique_ptr<VW::workspace>> _workers;
+  VW::thread_safe_queue<example*> _queue;
+  std::vector<VW::reductions::details::gd_per_model_state> _initial_gd_states;
+  std::mutex _finish_mutex;
+  std::mutex _in_flight_mutex;
+  std::condition_variable _idle;
+  size_t _in_flight = 0;
+  std::exception_ptr _exception;
+  std::atomic<bool> _failed{false};
+};
+
+// Driver for --instance_threads. Every workspace gets its own thread, which copies the broadcast examples into
+// examples of its own pool and runs them through the usual handler, so each instance sees the same stream as it
+// would in multi_instance_context and learns it in the same order. The calling thread reads the master's parser and
+// pushes each example to every instance's queue together with a reference count. The instance that drops the last
+// reference returns the example to the master's pool. A slow instance only holds up the others once its queue is
+// full.
+class instance_threads_driver
+{
+public:
+  static constexpr size_t QUEUE_SIZE_PER_INSTANCE = 256;
+
+  instance_threads_driver(const std::vector<VW::workspace*>& all) : _all(all)
+  {
+    for (size_t i = 0; i < _all.size(); i++)
+    {
+      _queues.push_back(VW::make_unique<VW::thread_safe_queue<broadcast_example*>>(QUEUE_SIZE_PER_INSTANCE));
+    }
+  }
+
+  void run()
+  {
+    auto& master = *_all.front();
+    std::vector<std::thread> threads;
+    auto join_guard = VW::scope_exit(
+        [this, &threads]
+        {
+          for (auto& queue : _queues) { queue->set_done(); }
+          for (auto& t : threads) { t.join(); }
+        });
+    for (size_t i = 0; i < _all.size(); i++) { threads.emplace_back(&instance_threads_driver::instance_loop, this, i); }
+
+    ready_examples_queue examples(master);
+    example* ec;
+    while (!failed() && (ec = examples.pop()) != nullptr)
+    {
+      auto* shared = _broadcast_pool.get_object().release();
+      shared->ec = ec;
+      shared->refs.store(_all.size(), std::memory_order_relaxed);
+      for (auto& queue : _queues) { queue->push(shared); }
+    }
+
+    join_guard.call();
+    if (_exception) { std::rethrow_exception(_exception); }
+    drain_examples(master);
+  }
+
+private:
+  class broadcast_example
+  {
+  public:
+    example* ec = nullptr;
+    std::atomic<size_t> refs{0};
+  };
+
+  // Hands the instance its own copy of each broadcast example.
+  class instance_queue
+  {
+  public:
+    instance_queue(instance_threads_driver& driver, size_t index) : _driver(driver), _index(index) {}
+
+    example* pop()
+    {
+      broadcast_example* shared;
+      if (_driver.failed() || !_driver._queues[_index]->try_pop(shared)) { return nullptr; }
+      auto& instance = *_driver._all[_index];
+      auto* copy = &VW::get_unused_example(&instance);
+      VW::copy_example_data_with_label(copy, shared->ec);
+      copy->ex_reduction_features = shared->ec->ex_reduction_features;
+      _driver.release(shared);
+      return copy;
+    }
+
+  private:
+    instance_threads_driver& _driver;
+    size_t _index;
+  };
+
+  void release(broadcast_example* shared)
+  {
+    if (shared->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) { return; }
+    // Every instance learns from and finishes its own copy, so the original is returned without being counted as
+    // finished a second time.
+    VW::details::clean_example(*_all.front(), *shared->ec);
+    _broadcast_pool.return_object(shared);
+  }
+
+  bool failed() const { return _failed.load(std::memory_order_relaxed); }
+
+  void instance_loop(size_t index)
+  {
+    auto& instance = *_all[index];
+    instance_queue examples(*this, index);
+    try
+    {
+      single_instance_context context(instance);
+      if (instance.l->is_multiline())
+      {
+        multi_example_handler<single_instance_context> handler(context);
+        process_examples(examples, handler);
+        handler.process_remaining();
+      }
+      else
+      {
+        single_example_handler<single_instance_context> handler(context);
+        process_examples(examples, handler);
+        handler.process_remaining();
+      }
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock(_exception_mutex);
+      if (_exception == nullptr) { _exception = std::current_exception(); }
+      _failed = true;
+    }
+    // Drop the references this instance still holds so that the master can stop.
+    broadcast_example* shared;
+    while (_queues[index]->try_pop(shared)) { release(shared); }
+  }
+
+  std::vector<VW::workspace*> _all;
+  std::vector<std::unique_ptr<VW::thread_safe_queue<broadcast_example*>>> _queues;
+  VW::object_pool<broadcast_example> _broadcast_pool;
+  std::mutex _exception_mutex;
+  std::exception_ptr _exception;
+  std::atomic<bool> _failed{false};
+};
+
 void generic_driver(VW::workspace& all)
 {
+  if (all.runtime_config.learner_threads > 1)
+  {
+    learner_threads_driver driver(all);
+    driver.run();
+    return;
+  }
+
   single_instance_context context(all);
   ready_examples_queue examples(all);
   generic_driver(examples, context);
@@ -299,6 +673,19 @@ void generic_driver(VW::workspace& all)
 
 void generic_driver(const std::vector<VW::workspace*>& all)
 {
+  for (const auto* ws : all)
+  {
+    if (ws->runtime_config.learner_threads > 1) { THROW("--learner_threads is not supported with multiple learners"); }
+  }
+  const bool instance_threads = std::any_of(
+      all.begin(), all.end(), [](const VW::workspace* ws) { return ws->runtime_config.instance_threads; });
+  if (instance_threads && all.size() > 1)
+  {
+    instance_threads_driver driver(all);
+    driver.run();
+    return;
+  }
+
   multi_instance_context context(all);
   ready_examples_queue examples(context.get_master());
   generic_driver(examples, context);
@@ -322,6 +709,7 @@ void generic_driver_onethread(VW::workspace& all)
 
 void generic_driver_onethread(VW::workspace& all)
 {
+  if (all.runtime_config.learner_threads > 1) { THROW("--learner_threads cannot be used with --onethread"); }
   if (all.l->is_multiline()) { generic_driver_onethread<multi_example_handler<single_instance_context>>(all); }
   else { generic_driver_onethread<single_example_handler<single_instance_context>>(all); }
 }
@@ -396,7 +784,29 @@ void learner::predict(polymorphic_ex ec, size_t i)
 void learner::multipredict(polymorphic_ex ec, size_t lo, size_t count, polyprediction* pred, bool finalize_predictions)
 {
   assert(is_multiline() == ec.is_multiline());
-  if (_multipredict_f == nullptr)
+  if (_multipredict_f == nullptr && ec.is_multiline())
+  {
+    // Multiline predictions live on the first example. Each offset's prediction is produced in place of the caller's
+    // buffer and moved out, so the example keeps the prediction it had before the call.
+    VW::multi_ex& examples = ec;
+    details::increment_offset(ec, feature_width_below, lo);
+    debug_log_message(ec, "multipredict");
+    if (!examples.empty())
+    {
+      VW::polyprediction saved = std::move(examples[0]->pred);
+      for (size_t c = 0; c < count; c++)
+      {
+        examples[0]->pred = std::move(pred[c]);
+        _predict_f(ec);
+        pred[c] = std::move(examples[0]->pred);
+        details::increment_offset(ec, feature_width_below, 1);
+      }
+      examples[0]->pred = std::move(saved);
+      details::decrement_offset(ec, feature_width_below, count);
+    }
+    details::decrement_offset(ec, feature_width_below, lo);
+  }
+  else if (_multipredict_f == nullptr)
   {
     details::increment_offset(ec, feature_width_below, lo);
     debug_log_message(ec, "multipredict");
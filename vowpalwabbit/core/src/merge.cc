@@ -11,12 +11,18 @@
 #include "vw/core/learner.h"
 #include "vw/core/memory.h"
 #include "vw/core/parse_primitives.h"
+#include "vw/core/reductions/gd.h"
 #include "vw/core/shared_data.h"
+#include "vw/core/thread_pool.h"
 #include "vw/core/vw.h"
 #include "vw/core/vw_math.h"
 #include "vw/io/io_adapter.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <future>
 #include <limits>
 
 namespace
@@ -26,7 +32,15 @@ std::string get_keep_command_line(const VW::workspace& workspace)
   VW::config::cli_options_serializer serializer;
   for (auto const& option : workspace.options->get_all_options())
   {
-    if (workspace.options->was_supplied(option->m_name) && option->m_keep) { serializer.add(*option); }
+    if (!workspace.options->was_supplied(option->m_name) || !option->m_keep) { continue; }
+    // A model loaded from disk always has --hash_algorithm, but murmur3 is the default and models leave it out, so it
+    // must not tell an otherwise identical trained and loaded model apart.
+    if (option->m_name == "hash_algorithm" &&
+        dynamic_cast<const VW::config::typed_option<std::string>&>(*option).value() == "murmur3")
+    {
+      continue;
+    }
+    serializer.add(*option);
   }
 
   return serializer.str();
@@ -91,20 +105,153 @@ void validate_compatibility(const std::vector<const VW::workspace*>& workspaces,
   }
 }
 
-std::unique_ptr<VW::workspace> copy_workspace(const VW::workspace* ws, VW::io::logger* logger = nullptr)
+// Creates the workspace a merge is written into, from the options every model to merge was trained with.
+std::unique_ptr<VW::workspace> create_merge_destination(const VW::workspace& model, VW::io::logger* logger)
 {
-  assert(ws != nullptr);
-  auto command_line = VW::split_command_line(get_keep_command_line(*ws));
+  auto command_line = VW::split_command_line(get_keep_command_line(model));
+  // The weight table size and --sparse_weights are not kept options, but the destination must use the same weight
+  // layout as the sources.
+  command_line.emplace_back("--bit_precision");
+  command_line.emplace_back(std::to_string(model.initial_weights_config.num_bits));
+  if (model.weights.sparse) { command_line.emplace_back("--sparse_weights"); }
   if (logger == nullptr) { command_line.emplace_back("--quiet"); }
   else { command_line.emplace_back("--driver_output_off"); }
   command_line.emplace_back("--preserve_performance_counters");
+  return VW::initialize(VW::make_unique<VW::config::options_cli>(command_line), nullptr, nullptr, nullptr, logger);
+}
 
-  auto backing_vector = std::make_shared<std::vector<char>>();
-  VW::io_buf temp_buffer;
-  temp_buffer.add_file(VW::io::create_vector_writer(backing_vector));
-  VW::save_predictor(*const_cast<VW::workspace*>(ws), temp_buffer);
-  return VW::initialize(VW::make_unique<VW::config::options_cli>(command_line),
-      VW::io::create_buffer_view(backing_vector->data(), backing_vector->size()), nullptr, nullptr, logger);
+void merge_shared_data(const VW::shared_data& source, VW::shared_data& dest)
+{
+  dest.sum_loss += source.sum_loss;
+  dest.weighted_labeled_examples += source.weighted_labeled_examples;
+  dest.weighted_labels += source.weighted_labels;
+  dest.weighted_unlabeled_examples += source.weighted_unlabeled_examples;
+  dest.example_number += source.example_number;
+  dest.total_features += source.total_features;
+  dest.t += source.t;
+  dest.max_label = std::max(dest.max_label, source.max_label);
+  dest.min_label = std::min(dest.min_label, source.min_label);
+}
+
+// Folds the weights of one model at a time into the weights of the output workspace, in place, with the same result
+// as gd's merge over all models at once.
+//  - Without adaptive slots, each model's weight is summed scaled by its example count, and divided by the total count
+//    once every model has been added.
+//  - With adaptive slots (dense only), gd scales every model's weight, adaptive and normalized slots by the model's
+//    share of the row's adaptive total before summing. Here those slots are summed scaled by the model's adaptive
+//    value and divided by the adaptive total at the end, which only needs the per-row totals on the side. All other
+//    slots are summed as is.
+class streaming_weight_merger
+{
+public:
+  streaming_weight_merger(VW::parameters& output, uint64_t length, size_t normalized_idx)
+      : _output(output)
+      , _length(length)
+      , _normalized_idx(normalized_idx)
+      , _adaptive_totals(output.adaptive ? length : 0, 0.f)
+      , _normalized_sums(output.adaptive && normalized_idx > 1 ? length : 0, 0.f)
+  {
+    if (output.sparse && output.adaptive) { THROW("Sparse parameters not supported for merging with save_resume"); }
+  }
+
+  uint64_t length() const { return _length; }
+
+  void add(const VW::parameters& source, float example_count, uint64_t begin_row, uint64_t end_row)
+  {
+    if (_output.sparse)
+    {
+      for (uint64_t row = begin_row; row < end_row; row++)
+      {
+        _output.sparse_weights.strided_index(row) += source.sparse_weights.strided_index(row) * example_count;
+      }
+    }
+    else if (!_output.adaptive)
+    {
+      for (uint64_t row = begin_row; row < end_row; row++)
+      {
+        _output.dense_weights.strided_index(row) += source.dense_weights.strided_index(row) * example_count;
+      }
+    }
+    else
+    {
+      const uint32_t stride_shift = _output.dense_weights.stride_shift();
+      const uint64_t stride = static_cast<uint64_t>(1) << stride_shift;
+      for (uint64_t row = begin_row; row < end_row; row++)
+      {
+        const VW::weight* w = &source.dense_weights[row << stride_shift];
+        VW::weight* sums = &_output.dense_weights[row << stride_shift];
+        const float adaptive = w[1];
+        _adaptive_totals[row] += adaptive;
+        sums[0] += w[0] * adaptive;
+        sums[1] += adaptive * adaptive;
+        for (uint64_t k = 2; k < stride; k++)
+        {
+          if (k == _normalized_idx)
+          {
+            sums[k] += w[k] * adaptive;
+            _normalized_sums[row] += w[k];
+          }
+          else { sums[k] += w[k]; }
+        }
+      }
+    }
+  }
+
+  void finish(float total_count, uint64_t begin_row, uint64_t end_row)
+  {
+    if (!_output.adaptive)
+    {
+      for (uint64_t row = begin_row; row < end_row; row++) { _output.strided_index(row) /= total_count; }
+      return;
+    }
+
+    const uint32_t stride_shift = _output.dense_weights.stride_shift();
+    for (uint64_t row = begin_row; row < end_row; row++)
+    {
+      VW::weight* w = &_output.dense_weights[row << stride_shift];
+      const float total = _adaptive_totals[row];
+      if (total > 0)
+      {
+        w[0] /= total;
+        w[1] /= total;
+        if (_normalized_idx > 1) { w[_normalized_idx] /= total; }
+      }
+      else
+      {
+        // Rows no model has adapted are zeroed but keep their unscaled state, as in do_weighting.
+        w[0] = 0.f;
+        w[1] = total;
+        if (_normalized_idx > 1) { w[_normalized_idx] = _normalized_sums[row]; }
+      }
+    }
+  }
+
+private:
+  VW::parameters& _output;
+  uint64_t _length;
+  size_t _normalized_idx;
+  std::vector<float> _adaptive_totals;
+  std::vector<float> _normalized_sums;
+};
+
+constexpr uint64_t MERGE_BLOCK_ROWS = 1 << 16;
+
+// Runs func(begin_row, end_row) over blocks of rows, on the pool when there is one.
+template <typename F>
+void for_each_row_block(VW::thread_pool* pool, uint64_t length, F&& func)
+{
+  if (pool == nullptr || length < 2 * MERGE_BLOCK_ROWS)
+  {
+    func(uint64_t{0}, length);
+    return;
+  }
+
+  std::vector<std::future<void>> futures;
+  for (uint64_t begin = 0; begin < length; begin += MERGE_BLOCK_ROWS)
+  {
+    futures.emplace_back(pool->submit(std::ref(func), begin, std::min(length, begin + MERGE_BLOCK_ROWS)));
+  }
+  for (auto& future : futures) { future.get(); }
 }
 
 std::vector<float> calc_per_model_weighting(const std::vector<float>& example_counts)
@@ -143,6 +290,383 @@ private:
   VW::io::writer& _inner_ref;
 };
 
+// Replays bytes already consumed from a reader before continuing with the reader itself.
+class prefixed_reader_adapter : public VW::io::reader
+{
+public:
+  prefixed_reader_adapter(std::vector<char> prefix, VW::io::reader& ref)
+      : VW::io::reader(false), _prefix(std::move(prefix)), _inner_ref(ref)
+  {
+  }
+  ssize_t read(char* buffer, size_t num_bytes) override
+  {
+    if (_offset < _prefix.size())
+    {
+      const auto num_copied = std::min(num_bytes, _prefix.size() - _offset);
+      std::memcpy(buffer, _prefix.data() + _offset, num_copied);
+      _offset += num_copied;
+      return static_cast<ssize_t>(num_copied);
+    }
+    return _inner_ref.read(buffer, num_bytes);
+  }
+
+private:
+  std::vector<char> _prefix;
+  size_t _offset = 0;
+  VW::io::reader& _inner_ref;
+};
+
+// Sparse delta layout. The header is never compressed:
+//   magic "VWMD", uint8 version, uint8 value encoding, uint8 compressed, uint8 first slot only, uint32 stride
+// followed by the payload, deflated when compressed is set:
+//   uint64 skeleton size, skeleton bytes (save_predictor output without the weights)
+//   uint64 row count, then blocks of up to SPARSE_DELTA_BLOCK_ROWS rows:
+//     uint32 rows in block, uint64 mask of the slots that are nonzero in any row,
+//     one float scale per shipped slot (INT8 only),
+//     varint weight index deltas (restarting from zero in every block), one value per shipped slot per row
+// A shipped slot is one in the mask, or any slot beyond the 64th. When first slot only is set, only slot 0 is
+// considered and the other slots of every row are left zero.
+constexpr std::array<char, 4> SPARSE_DELTA_MAGIC = {'V', 'W', 'M', 'D'};
+constexpr uint8_t SPARSE_DELTA_VERSION = 2;
+constexpr size_t SPARSE_DELTA_BLOCK_ROWS = 4096;
+
+template <typename T>
+void append_value(std::vector<char>& buffer, T value)
+{
+  const auto* bytes = reinterpret_cast<const char*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+void append_varint(std::vector<char>& buffer, uint64_t value)
+{
+  while (value >= 0x80)
+  {
+    buffer.push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  buffer.push_back(static_cast<char>(value));
+}
+
+// Buffers a reader so the varint decoding does not pay a virtual call per byte.
+class delta_input
+{
+public:
+  explicit delta_input(VW::io::reader& reader) : _reader(reader), _buffer(1 << 16) {}
+
+  void read(char* output, size_t num_bytes)
+  {
+    while (num_bytes > 0)
+    {
+      if (_pos == _end) { refill(); }
+      const auto num_copied = std::min(num_bytes, _end - _pos);
+      std::memcpy(output, _buffer.data() + _pos, num_copied);
+      _pos += num_copied;
+      output += num_copied;
+      num_bytes -= num_copied;
+    }
+  }
+
+  template <typename T>
+  T read_value()
+  {
+    T value;
+    read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+  }
+
+  uint64_t read_varint()
+  {
+    uint64_t value = 0;
+    for (uint32_t shift = 0; shift < 64; shift += 7)
+    {
+      if (_pos == _end) { refill(); }
+      const auto byte = static_cast<uint8_t>(_buffer[_pos++]);
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) { return value; }
+    }
+    THROW("Malformed weight index in serialized model delta");
+  }
+
+private:
+  void refill()
+  {
+    const auto num_read = _reader.read(_buffer.data(), _buffer.size());
+    if (num_read <= 0) { THROW("Unexpected end of serialized model delta"); }
+    _pos = 0;
+    _end = static_cast<size_t>(num_read);
+  }
+
+  VW::io::reader& _reader;
+  std::vector<char> _buffer;
+  size_t _pos = 0;
+  size_t _end = 0;
+};
+
+size_t read_up_to(VW::io::reader& reader, char* buffer, size_t num_bytes)
+{
+  size_t total = 0;
+  while (total < num_bytes)
+  {
+    const auto num_read = reader.read(buffer + total, num_bytes - total);
+    if (num_read <= 0) { break; }
+    total += static_cast<size_t>(num_read);
+  }
+  return total;
+}
+
+// Round to nearest even IEEE half precision. Values beyond the half range become infinity.
+uint16_t float_to_half(float value)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+  const auto float_exponent = static_cast<int32_t>((bits >> 23) & 0xff);
+  uint32_t mantissa = bits & 0x7fffff;
+
+  if (float_exponent == 0xff) { return sign | 0x7c00 | (mantissa != 0 ? 0x200 : 0); }
+  const int32_t exponent = float_exponent - 127 + 15;
+  if (exponent >= 31) { return sign | 0x7c00; }
+  if (exponent <= 0)
+  {
+    if (exponent < -10) { return sign; }
+    mantissa |= 0x800000;
+    const auto shift = static_cast<uint32_t>(14 - exponent);
+    uint32_t half_mantissa = mantissa >> shift;
+    const uint32_t remainder = mantissa & ((1u << shift) - 1);
+    const uint32_t halfway = 1u << (shift - 1);
+    if (remainder > halfway || (remainder == halfway && (half_mantissa & 1) != 0)) { half_mantissa++; }
+    return static_cast<uint16_t>(sign | half_mantissa);
+  }
+
+  // A carry out of the mantissa correctly bumps the exponent, up to infinity.
+  uint32_t half = (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+  const uint32_t remainder = mantissa & 0x1fff;
+  if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1) != 0)) { half++; }
+  return static_cast<uint16_t>(sign | half);
+}
+
+float half_to_float(uint16_t half)
+{
+  const uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+  const uint32_t exponent = (half >> 10) & 0x1f;
+  uint32_t mantissa = half & 0x3ff;
+
+  uint32_t bits;
+  if (exponent == 0x1f) { bits = sign | 0x7f800000 | (mantissa << 13); }
+  else if (exponent != 0) { bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13); }
+  else if (mantissa == 0) { bits = sign; }
+  else
+  {
+    // Subnormal half, normalize it.
+    uint32_t float_exponent = 127 - 15 + 1;
+    while ((mantissa & 0x400) == 0)
+    {
+      mantissa <<= 1;
+      float_exponent--;
+    }
+    bits = sign | (float_exponent << 23) | ((mantissa & 0x3ff) << 13);
+  }
+
+  float value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// Weight rows with a nonzero value in one of their first num_slots slots, in increasing weight index order.
+std::vector<std::pair<uint64_t, const VW::weight*>> nonzero_weight_rows(
+    const VW::parameters& weights, uint64_t num_slots)
+{
+  std::vector<std::pair<uint64_t, const VW::weight*>> rows;
+  const auto stride = weights.stride();
+  const auto has_nonzero = [num_slots](const VW::weight* row)
+  { return std::any_of(row, row + num_slots, [](VW::weight w) { return w != 0.f; }); };
+
+  if (weights.sparse)
+  {
+    for (auto it = weights.sparse_weights.cbegin(); it != weights.sparse_weights.cend(); ++it)
+    {
+      if (has_nonzero(&(*it))) { rows.emplace_back(it.index(), &(*it)); }
+    }
+    std::sort(rows.begin(), rows.end(),
+        [](const std::pair<uint64_t, const VW::weight*>& a, const std::pair<uint64_t, const VW::weight*>& b)
+        { return a.first < b.first; });
+  }
+  else
+  {
+    const auto* data = weights.dense_weights.data();
+    const auto length = weights.dense_weights.mask() + 1;
+    for (uint64_t index = 0; index < length; index += stride)
+    {
+      if (has_nonzero(data + index)) { rows.emplace_back(index, data + index); }
+    }
+  }
+  return rows;
+}
+
+inline bool slot_included(uint64_t slot_mask, uint64_t slot, uint64_t num_slots)
+{
+  return slot < num_slots && (slot >= 64 || ((slot_mask >> slot) & 1) != 0);
+}
+
+void write_weight_block(VW::io::writer& output, const std::vector<std::pair<uint64_t, const VW::weight*>>& rows,
+    size_t begin, size_t end, uint64_t num_slots, VW::model_delta_value_encoding encoding, std::vector<char>& buffer)
+{
+  buffer.clear();
+  append_value(buffer, static_cast<uint32_t>(end - begin));
+
+  // Most learners leave some slots of every row unused, there is no need to ship their zeros.
+  uint64_t slot_mask = 0;
+  for (size_t i = begin; i < end; i++)
+  {
+    for (uint64_t k = 0; k < std::min<uint64_t>(num_slots, 64); k++)
+    {
+      if (rows[i].second[k] != 0.f) { slot_mask |= static_cast<uint64_t>(1) << k; }
+    }
+  }
+  append_value(buffer, slot_mask);
+
+  // The slots hold quantities of very different magnitude (a weight next to a sum of squared gradients), so each
+  // slot is quantized against its own scale.
+  std::vector<float> scales;
+  if (encoding == VW::model_delta_value_encoding::INT8)
+  {
+    scales.assign(num_slots, 0.f);
+    for (size_t i = begin; i < end; i++)
+    {
+      for (uint64_t k = 0; k < num_slots; k++) { scales[k] = std::max(scales[k], std::fabs(rows[i].second[k])); }
+    }
+    for (uint64_t k = 0; k < num_slots; k++)
+    {
+      scales[k] /= 127.f;
+      if (slot_included(slot_mask, k, num_slots)) { append_value(buffer, scales[k]); }
+    }
+  }
+
+  uint64_t previous = 0;
+  for (size_t i = begin; i < end; i++)
+  {
+    append_varint(buffer, rows[i].first - previous);
+    previous = rows[i].first;
+  }
+
+  for (size_t i = begin; i < end; i++)
+  {
+    for (uint64_t k = 0; k < num_slots; k++)
+    {
+      if (!slot_included(slot_mask, k, num_slots)) { continue; }
+      const float value = rows[i].second[k];
+      switch (encoding)
+      {
+        case VW::model_delta_value_encoding::FLOAT32:
+          append_value(buffer, value);
+          break;
+        case VW::model_delta_value_encoding::FLOAT16:
+          append_value(buffer, float_to_half(value));
+          break;
+        case VW::model_delta_value_encoding::INT8:
+        {
+          const float quantized = scales[k] > 0.f ? std::round(value / scales[k]) : 0.f;
+          append_value(buffer, static_cast<int8_t>(std::max(-127.f, std::min(127.f, quantized))));
+          break;
+        }
+      }
+    }
+  }
+  output.write(buffer.data(), buffer.size());
+}
+
+float read_weight_value(delta_input& input, VW::model_delta_value_encoding encoding, float scale)
+{
+  switch (encoding)
+  {
+    case VW::model_delta_value_encoding::FLOAT32:
+      return input.read_value<float>();
+    case VW::model_delta_value_encoding::FLOAT16:
+      return half_to_float(input.read_value<uint16_t>());
+    case VW::model_delta_value_encoding::INT8:
+      return static_cast<float>(input.read_value<int8_t>()) * scale;
+  }
+  return 0.f;
+}
+
+std::unique_ptr<VW::model_delta> deserialize_sparse(VW::io::reader& input)
+{
+  std::array<char, 4> header;
+  if (read_up_to(input, header.data(), header.size()) != header.size())
+  {
+    THROW("Unexpected end of serialized model delta");
+  }
+  const auto version = static_cast<uint8_t>(header[0]);
+  const auto encoding = static_cast<VW::model_delta_value_encoding>(header[1]);
+  const bool compressed = header[2] != 0;
+  const bool first_slot_only = header[3] != 0;
+  if (version != SPARSE_DELTA_VERSION) { THROW("Unsupported sparse model delta version: " << int(version)); }
+  if (static_cast<uint8_t>(header[1]) > static_cast<uint8_t>(VW::model_delta_value_encoding::INT8))
+  {
+    THROW("Unsupported sparse model delta value encoding: " << int(static_cast<uint8_t>(header[1])));
+  }
+
+  uint32_t stride = 0;
+  if (read_up_to(input, reinterpret_cast<char*>(&stride), sizeof(stride)) != sizeof(stride))
+  {
+    THROW("Unexpected end of serialized model delta");
+  }
+
+  std::unique_ptr<VW::io::reader> payload_reader = VW::make_unique<reader_ref_adapter>(input);
+  if (compressed) { payload_reader = VW::io::create_zlib_reader(std::move(payload_reader)); }
+  delta_input payload(*payload_reader);
+
+  std::vector<char> skeleton(payload.read_value<uint64_t>());
+  payload.read(skeleton.data(), skeleton.size());
+  auto command_line = std::vector<std::string>{"--preserve_performance_counters", "--quiet"};
+  auto ws = VW::initialize(VW::make_unique<VW::config::options_cli>(command_line),
+      VW::io::create_buffer_view(skeleton.data(), skeleton.size()));
+
+  auto& weights = ws->weights;
+  if (weights.stride() != stride)
+  {
+    THROW("Serialized model delta has weight stride " << stride << " but the model it describes has stride "
+                                                      << weights.stride());
+  }
+
+  const uint64_t num_slots = first_slot_only ? 1 : stride;
+  const auto num_rows = payload.read_value<uint64_t>();
+  uint64_t rows_read = 0;
+  std::vector<VW::weight*> block_rows;
+  std::vector<float> scales(num_slots, 0.f);
+  while (rows_read < num_rows)
+  {
+    const auto block_size = payload.read_value<uint32_t>();
+    if (block_size == 0 || block_size > num_rows - rows_read) { THROW("Malformed block in serialized model delta"); }
+    const auto slot_mask = payload.read_value<uint64_t>();
+    if (encoding == VW::model_delta_value_encoding::INT8)
+    {
+      for (uint64_t k = 0; k < num_slots; k++)
+      {
+        scales[k] = slot_included(slot_mask, k, num_slots) ? payload.read_value<float>() : 0.f;
+      }
+    }
+
+    block_rows.clear();
+    uint64_t index = 0;
+    for (uint32_t i = 0; i < block_size; i++)
+    {
+      index += payload.read_varint();
+      block_rows.push_back(&weights[index]);
+    }
+    for (auto* row : block_rows)
+    {
+      for (uint32_t k = 0; k < stride; k++)
+      {
+        row[k] = slot_included(slot_mask, k, num_slots) ? read_weight_value(payload, encoding, scales[k]) : 0.f;
+      }
+    }
+    rows_read += block_size;
+  }
+
+  return VW::make_unique<VW::model_delta>(std::move(ws));
+}
+
 }  // namespace
 
 namespace VW
@@ -154,11 +678,66 @@ void model_delta::serialize(VW::io::writer& output) const
   VW::save_predictor(*_ws, buffer);
 }
 
+void model_delta::serialize_sparse(VW::io::writer& output, const model_delta_serialize_options& options) const
+{
+  const auto& weights = _ws->weights;
+  const auto stride = weights.stride();
+  // The other slots hold optimizer state (adaptive and normalized sums) that is only needed when the model is saved
+  // with it, the same as save_predictor would.
+  const bool first_slot_only = !_ws->output_model_config.save_resume;
+  const uint64_t num_slots = first_slot_only ? 1 : stride;
+  const auto rows = nonzero_weight_rows(weights, num_slots);
+
+  // Save everything but the weights as a regular model, so the skeleton stays small no matter how many weights the
+  // delta touches.
+  auto skeleton = std::make_shared<std::vector<char>>();
+  {
+    io_buf buffer;
+    buffer.skip_weights(true);
+    buffer.add_file(VW::io::create_vector_writer(skeleton));
+    VW::save_predictor(*_ws, buffer);
+  }
+
+  std::vector<char> block;
+  block.insert(block.end(), SPARSE_DELTA_MAGIC.begin(), SPARSE_DELTA_MAGIC.end());
+  block.push_back(static_cast<char>(SPARSE_DELTA_VERSION));
+  block.push_back(static_cast<char>(options.value_encoding));
+  block.push_back(static_cast<char>(options.compress ? 1 : 0));
+  block.push_back(static_cast<char>(first_slot_only ? 1 : 0));
+  append_value(block, static_cast<uint32_t>(stride));
+  output.write(block.data(), block.size());
+
+  std::unique_ptr<VW::io::writer> payload = VW::make_unique<writer_ref_adapter>(output);
+  if (options.compress) { payload = VW::io::create_zlib_writer(std::move(payload)); }
+
+  block.clear();
+  append_value(block, static_cast<uint64_t>(skeleton->size()));
+  payload->write(block.data(), block.size());
+  payload->write(skeleton->data(), skeleton->size());
+
+  block.clear();
+  append_value(block, static_cast<uint64_t>(rows.size()));
+  payload->write(block.data(), block.size());
+  for (size_t begin = 0; begin < rows.size(); begin += SPARSE_DELTA_BLOCK_ROWS)
+  {
+    const auto end = std::min(rows.size(), begin + SPARSE_DELTA_BLOCK_ROWS);
+    write_weight_block(*payload, rows, begin, end, num_slots, options.value_encoding, block);
+  }
+  payload->flush();
+}
+
 std::unique_ptr<model_delta> model_delta::deserialize(VW::io::reader& input)
 {
+  std::vector<char> magic(SPARSE_DELTA_MAGIC.size());
+  magic.resize(read_up_to(input, magic.data(), magic.size()));
+  if (magic.size() == SPARSE_DELTA_MAGIC.size() && std::equal(magic.begin(), magic.end(), SPARSE_DELTA_MAGIC.begin()))
+  {
+    return deserialize_sparse(input);
+  }
+
   auto command_line = std::vector<std::string>{"--preserve_performance_counters", "--quiet"};
-  return VW::make_unique<model_delta>(VW::initialize(
-      VW::make_unique<VW::config::options_cli>(command_line), VW::make_unique<reader_ref_adapter>(input)));
+  return VW::make_unique<model_delta>(VW::initialize(VW::make_unique<VW::config::options_cli>(command_line),
+      VW::make_unique<prefixed_reader_adapter>(std::move(magic), input)));
 }
 
 VW::model_delta merge_deltas(const std::vector<const VW::model_delta*>& deltas_to_merge, VW::io::logger* logger)
@@ -169,13 +748,7 @@ VW::model_delta merge_deltas(const std::vector<const VW::model_delta*>& deltas_t
   for (const auto delta_ptr : deltas_to_merge) { workspaces_to_merge.push_back(delta_ptr->unsafe_get_workspace_ptr()); }
   validate_compatibility(workspaces_to_merge, logger);
 
-  // Get VW command line and create output workspace
-  auto command_line = VW::split_command_line(get_keep_command_line(*workspaces_to_merge[0]));
-  if (logger == nullptr) { command_line.emplace_back("--quiet"); }
-  else { command_line.emplace_back("--driver_output_off"); }
-  command_line.emplace_back("--preserve_performance_counters");
-  auto dest_workspace =
-      VW::initialize(VW::make_unique<VW::config::options_cli>(command_line), nullptr, nullptr, nullptr, logger);
+  auto dest_workspace = create_merge_destination(*workspaces_to_merge[0], logger);
 
   // Get example counts and compute weighting of models
   std::vector<float> example_counts;
@@ -222,20 +795,112 @@ VW::model_delta merge_deltas(const std::vector<const VW::model_delta*>& deltas_t
   }
 
   // Merge shared data
-  for (const auto* delta : workspaces_to_merge)
+  for (const auto* delta : workspaces_to_merge) { merge_shared_data(*delta->sd, *dest_workspace->sd); }
+
+  return VW::model_delta(std::move(dest_workspace));
+}
+
+std::unique_ptr<VW::workspace> merge_models_streaming(const VW::workspace* base_workspace, size_t num_models,
+    const std::function<std::unique_ptr<VW::workspace>(size_t)>& load_model, size_t num_threads,
+    VW::io::logger* logger)
+{
+  if (num_models < 2) { THROW("Must specify at least two model files to merge."); }
+
+  std::unique_ptr<VW::thread_pool> pool;
+  if (num_threads > 0) { pool = VW::make_unique<VW::thread_pool>(num_threads); }
+
+  // Every model is folded into a single output workspace as soon as it is loaded and then released. Its weights are
+  // accumulated in place and normalized once all example counts are known. The state of the other learners and the
+  // shared data is additive, so it is merged one model at a time. The next model is loaded in the background while
+  // the current one is folded in, so apart from the base model at most three models are held in memory at once.
+  std::unique_ptr<VW::workspace> merged;
+  std::unique_ptr<streaming_weight_merger> weight_merger;
+  float total_count = 0.f;
+  std::future<std::unique_ptr<VW::workspace>> next_model;
+  if (pool) { next_model = pool->submit(load_model, size_t{0}); }
+
+  for (size_t i = 0; i < num_models; i++)
   {
-    dest_workspace->sd->sum_loss += delta->sd->sum_loss;
-    dest_workspace->sd->weighted_labeled_examples += delta->sd->weighted_labeled_examples;
-    dest_workspace->sd->weighted_labels += delta->sd->weighted_labels;
-    dest_workspace->sd->weighted_unlabeled_examples += delta->sd->weighted_unlabeled_examples;
-    dest_workspace->sd->example_number += delta->sd->example_number;
-    dest_workspace->sd->total_features += delta->sd->total_features;
-    dest_workspace->sd->t += delta->sd->t;
-    dest_workspace->sd->max_label = std::max(dest_workspace->sd->max_label, delta->sd->max_label);
-    dest_workspace->sd->min_label = std::min(dest_workspace->sd->min_label, delta->sd->min_label);
+    auto model = pool ? next_model.get() : load_model(i);
+    std::unique_ptr<VW::model_delta> delta;
+    if (base_workspace != nullptr)
+    {
+      delta = VW::make_unique<VW::model_delta>(*model - *base_workspace);
+      model.reset();
+    }
+    else { delta = VW::make_unique<VW::model_delta>(std::move(model)); }
+    if (pool && i + 1 < num_models) { next_model = pool->submit(load_model, i + 1); }
+    const auto* source = delta->unsafe_get_workspace_ptr();
+
+    if (merged == nullptr)
+    {
+      merged = create_merge_destination(*source, logger);
+      weight_merger = VW::make_unique<streaming_weight_merger>(merged->weights,
+          static_cast<uint64_t>(1) << merged->initial_weights_config.num_bits,
+          merged->initial_weights_config.normalized_idx);
+    }
+    validate_compatibility(std::vector<const VW::workspace*>{merged.get(), source}, logger);
+    if (source->weights.stride_shift() != merged->weights.stride_shift() ||
+        source->weights.mask() != merged->weights.mask())
+    {
+      THROW("Model " << i << " has a different weight layout than the first model.");
+    }
+
+    const float example_count = source->sd->weighted_labeled_examples;
+    total_count += example_count;
+    // Sparse weights are created on first access, which is not thread safe.
+    for_each_row_block(merged->weights.sparse ? nullptr : pool.get(), weight_merger->length(),
+        [&weight_merger, source, example_count](uint64_t begin, uint64_t end)
+        { weight_merger->add(source->weights, example_count, begin, end); });
+
+    for (auto* target_learner = merged->l.get(); target_learner != nullptr;
+         target_learner = target_learner->get_base_learner())
+    {
+      auto* source_learner = source->l->get_learner_by_name_prefix(target_learner->get_name());
+      if (target_learner->get_base_learner() == nullptr)
+      {
+        // The bottom learner owns the weights merged above. Only gd can be merged, and its remaining state is
+        // additive.
+        if (target_learner->get_name() != "gd")
+        {
+          THROW("Bottom learner '" << target_learner->get_name()
+                                   << "' does not have a merge function defined. Since it is a bottom learner, "
+                                      "merging will not work as expected.");
+        }
+        auto& output_data = *static_cast<VW::reductions::gd*>(
+            target_learner->get_internal_type_erased_data_pointer_test_use_only());
+        const auto& source_data =
+            *static_cast<VW::reductions::gd*>(source_learner->get_internal_type_erased_data_pointer_test_use_only());
+        for (size_t k = 0; k < output_data.gd_per_model_states.size(); k++)
+        {
+          output_data.gd_per_model_states[k].normalized_sum_norm_x +=
+              source_data.gd_per_model_states[k].normalized_sum_norm_x;
+          output_data.gd_per_model_states[k].total_weight += source_data.gd_per_model_states[k].total_weight;
+        }
+      }
+      else if (target_learner->has_merge())
+      {
+        // These learners sum their state into the output, so merging one model at a time gives the same result.
+        target_learner->merge(std::vector<float>{1.f}, std::vector<const VW::workspace*>{source},
+            std::vector<const VW::LEARNER::learner*>{source_learner}, *merged, *target_learner);
+      }
+      else if (i == 0 && target_learner->learner_defines_own_save_load() && logger != nullptr)
+      {
+        logger->warn(
+            "Learner '{}' supports save/load but does not have a merge function defined. Merging will still run but "
+            "this learner will not be merged and may result in incorrect results.",
+            target_learner->get_name());
+      }
+    }
+
+    merge_shared_data(*source->sd, *merged->sd);
   }
 
-  return VW::model_delta(std::move(dest_workspace));
+  for_each_row_block(merged->weights.sparse ? nullptr : pool.get(), weight_merger->length(),
+      [&weight_merger, total_count](uint64_t begin, uint64_t end) { weight_merger->finish(total_count, begin, end); });
+
+  if (base_workspace != nullptr) { return *base_workspace + VW::model_delta(std::move(merged)); }
+  return merged;
 }
 
 std::unique_ptr<VW::workspace> merge_models(const VW::workspace* base_workspace,
@@ -253,7 +918,7 @@ std::unique_ptr<VW::workspace> merge_models(const VW::workspace* base_workspace,
     for (const auto* ws : workspaces_to_merge)
     {
       // No base workspace to subtract, but we must make a copy of workspace to give delta ownership of it
-      deltas.emplace_back(copy_workspace(ws, logger));
+      deltas.emplace_back(VW::clone_workspace(*ws, logger));
     }
   }
 
@@ -90,6 +90,19 @@ bool directory_exists(const std::string& path)
   //  return boost::filesystem::exists(p) && boost::filesystem::is_directory(p);
 }
 
+// Whether output to the stdout stream or to path is read as it arrives: a terminal, pipe or socket, rather than a
+// regular file or a file that does not exist yet.
+bool is_streaming_output(const std::string& path)
+{
+  class stat info;
+  if (path == "stdout")
+  {
+    if (fstat(1, &info) != 0) { return true; }
+  }
+  else if (stat(path.c_str(), &info) != 0) { return false; }
+  return (info.st_mode & S_IFMT) != S_IFREG;
+}
+
 std::string find_in_path(const std::vector<std::string>& paths, const std::string& fname)
 {
 #ifdef _WIN32
@@ -301,6 +314,7 @@ void parse_diagnostics(options_i& options, VW::workspace& all)
   bool version_arg = false;
   bool help = false;
   bool skip_driver = false;
+  bool startup_profile = false;
   std::string progress_arg;
   option_group_definition diagnostic_group("Diagnostic");
   diagnostic_group.add(make_option("version", version_arg).help("Version information"))
@@ -310,6 +324,9 @@ void parse_diagnostics(options_i& options, VW::workspace& all)
                .help("Progress update frequency. int: additive, float: multiplicative"))
       .add(make_option("dry_run", skip_driver)
                .help("Parse arguments and print corresponding metadata. Will not execute driver"))
+      .add(make_option("startup_profile", startup_profile)
+               .help("Print the time spent in each phase of initialization and in setting up each reduction. "
+                     "Printed with the other startup messages, so not shown with --quiet"))
       .add(make_option("help", help)
                .short_name("h")
                .help("More information on vowpal wabbit can be found here https://vowpalwabbit.org"));
@@ -536,6 +553,7 @@ void parse_feature_tweaks(options_i& options, VW::workspace& all, bool interacti
     std::vector<std::string>& dictionary_nses)
 {
   std::string hash_function;
+  std::string hash_algorithm;
   uint32_t new_bits;
   std::vector<std::string> spelling_ns;
   std::vector<std::string> quadratics;
@@ -565,6 +583,12 @@ void parse_feature_tweaks(options_i& options, VW::workspace& all, bool interacti
                .keep()
                .one_of({"strings", "all"})
                .help("How to hash the features"))
+      .add(make_option("hash_algorithm", hash_algorithm)
+               .default_value("murmur3")
+               .keep()
+               .one_of({"murmur3", "wyhash"})
+               .help("Hash function used for feature and namespace names. wyhash is faster on long feature names. "
+                     "Kept in the model file so that models are always scored with the hash they were trained with"))
       .add(
           make_option("hash_seed", all.runtime_config.hash_seed).keep().default_value(0).help("Seed for hash function"))
       .add(make_option("ignore", ignores).keep().help("Ignore namespaces beginning with character <arg>"))
@@ -629,7 +653,9 @@ void parse_feature_tweaks(options_i& options, VW::workspace& all, bool interacti
   options.add_and_parse(feature_options);
 
   // feature manipulation
-  all.parser_runtime.example_parser->hasher = VW::get_hasher(hash_function);
+  all.parser_runtime.example_parser->hasher = VW::get_hasher(hash_function, hash_algorithm);
+  all.parser_runtime.example_parser->uniform_hasher = VW::get_hasher("all", hash_algorithm);
+  all.parser_runtime.example_parser->string_hasher = VW::get_hasher("strings", hash_algorithm);
 
   if (options.was_supplied("spelling"))
   {
@@ -1238,27 +1264,49 @@ void parse_output_preds(options_i& options, VW::workspace& all)
 {
   std::string predictions;
   std::string raw_predictions;
+  std::string predictions_format;
+  bool async_predictions = false;
 
   option_group_definition output_options("Prediction Output");
   output_options.add(make_option("predictions", predictions).short_name("p").help("File to output predictions to"))
       .add(make_option("raw_predictions", raw_predictions)
                .short_name("r")
-               .help("File to output unnormalized predictions to"));
+               .help("File to output unnormalized predictions to"))
+      .add(make_option("predictions_format", predictions_format)
+               .default_value("text")
+               .one_of({"text", "binary"})
+               .help("Format of --predictions and --raw_predictions. binary writes each prediction as a 4-byte float "
+                     "in native byte order without its tag, and requires a learner with scalar predictions"))
+      .add(make_option("async_predictions", async_predictions)
+               .help("Buffer --predictions and --raw_predictions and write them to their files on a background "
+                     "thread. Terminals and pipes receive each prediction as it is made"));
   options.add_and_parse(output_options);
 
+  // Large buffers keep the number of write calls low; they are only handed to the writer thread once full. A reader
+  // on a terminal or pipe would wait for a whole buffer, so there every write, which is one prediction, is handed off
+  // on its own.
+  constexpr size_t ASYNC_PREDICTIONS_BUFFER_SIZE = 1 << 20;
+  auto wrap_sink = [async_predictions](std::unique_ptr<VW::io::writer> sink, const std::string& path)
+  {
+    if (!async_predictions) { return sink; }
+    return VW::io::create_background_writer(
+        std::move(sink), is_streaming_output(path) ? 1 : ASYNC_PREDICTIONS_BUFFER_SIZE);
+  };
+
   if (options.was_supplied("predictions"))
   {
     if (!all.output_config.quiet) { *(all.output_runtime.trace_message) << "predictions = " << predictions << endl; }
 
     if (predictions == "stdout")
     {
-      all.output_runtime.final_prediction_sink.push_back(VW::io::open_stdout());  // stdout
+      all.output_runtime.final_prediction_sink.push_back(wrap_sink(VW::io::open_stdout(), predictions));  // stdout
     }
     else
     {
       try
       {
-        all.output_runtime.final_prediction_sink.push_back(VW::io::open_file_writer(predictions));
+        all.output_runtime.final_prediction_sink.push_back(
+            wrap_sink(VW::io::open_file_writer(predictions), predictions));
       }
       catch (...)
       {
@@ -1277,8 +1325,11 @@ void parse_output_preds(options_i& options, VW::workspace& all)
         all.logger.err_warn("--raw_predictions has no defined value when --binary specified, expect no output");
       }
     }
-    if (raw_predictions == "stdout") { all.output_runtime.raw_prediction = VW::io::open_stdout(); }
-    else { all.output_runtime.raw_prediction = VW::io::open_file_writer(raw_predictions); }
+    if (raw_predictions == "stdout")
+    {
+      all.output_runtime.raw_prediction = wrap_sink(VW::io::open_stdout(), raw_predictions);
+    }
+    else { all.output_runtime.raw_prediction = wrap_sink(VW::io::open_file_writer(raw_predictions), raw_predictions); }
   }
 }
 
@@ -1513,6 +1564,10 @@ std::unique_ptr<VW::workspace> VW::details::parse_args(std::unique_ptr<options_i
 
   all->parser_runtime.example_parser = VW::make_unique<VW::parser>(final_example_queue_limit, strict_parse);
 
+  std::string huge_pages_arg;
+  std::string numa_arg;
+  std::string numa_nodes_arg;
+  uint64_t prefetch_distance_arg;
   option_group_definition weight_args("Weight");
   weight_args
       .add(make_option("initial_regressor", all->initial_weights_config.initial_regressors)
@@ -1529,15 +1584,59 @@ std::unique_ptr<VW::workspace> VW::details::parse_args(std::unique_ptr<options_i
                .help("Make initial weights truncated normal"))
       .add(make_option("sparse_weights", all->weights.sparse).help("Use a sparse datastructure for weights"))
       .add(make_option("input_feature_regularizer", all->initial_weights_config.per_feature_regularizer_input)
-               .help("Per feature regularization input file"));
+               .help("Per feature regularization input file"))
+      .add(make_option("weights_huge_pages", huge_pages_arg)
+               .default_value("none")
+               .one_of({"none", "transparent", "explicit"})
+               .help("Back the dense weight table with huge pages to cut TLB misses on large -b. transparent "
+                     "advises transparent huge pages; explicit maps pages from the reserved pool (vm.nr_hugepages) "
+                     "and falls back to transparent"))
+      .add(make_option("weights_numa", numa_arg)
+               .default_value("none")
+               .one_of({"none", "interleave", "bind"})
+               .help("NUMA placement of the dense weight table. interleave spreads its pages round robin over the "
+                     "nodes, bind allocates them only on the nodes"))
+      .add(make_option("weights_numa_nodes", numa_nodes_arg)
+               .help("Nodes used by --weights_numa, such as 0,2-3. Defaults to every online node"))
+      .add(make_option("weights_prefetch_distance", prefetch_distance_arg)
+               .default_value(0)
+               .help("Prefetch the dense weights of the feature this many features ahead while iterating features "
+                     "and interactions. Helps when the weight table is much larger than the last level cache. 0 "
+                     "turns prefetching off"));
   all->options->add_and_parse(weight_args);
 
+  auto& weight_allocation = all->initial_weights_config.weight_allocation;
+  if (huge_pages_arg == "transparent") { weight_allocation.huge_pages = VW::huge_pages_mode::TRANSPARENT; }
+  else if (huge_pages_arg == "explicit") { weight_allocation.huge_pages = VW::huge_pages_mode::EXPLICIT; }
+  if (numa_arg == "interleave") { weight_allocation.numa = VW::numa_policy::INTERLEAVE; }
+  else if (numa_arg == "bind") { weight_allocation.numa = VW::numa_policy::BIND; }
+  if (all->options->was_supplied("weights_numa_nodes"))
+  {
+    if (weight_allocation.numa == VW::numa_policy::NONE) { THROW("--weights_numa_nodes requires --weights_numa"); }
+    if (!VW::details::parse_numa_node_list(numa_nodes_arg, weight_allocation.numa_nodes))
+    {
+      THROW("Invalid --weights_numa_nodes '" << numa_nodes_arg << "', expected node numbers and ranges such as 0,2-3");
+    }
+  }
+  if (all->weights.sparse &&
+      (weight_allocation.huge_pages != VW::huge_pages_mode::NONE || weight_allocation.numa != VW::numa_policy::NONE))
+  {
+    THROW("--weights_huge_pages and --weights_numa only apply to dense weights, not --sparse_weights");
+  }
+  if (prefetch_distance_arg > 64) { THROW("--weights_prefetch_distance must be at most 64"); }
+  if (all->weights.sparse && prefetch_distance_arg != 0)
+  {
+    THROW("--weights_prefetch_distance only applies to dense weights, not --sparse_weights");
+  }
+  all->initial_weights_config.prefetch_distance = static_cast<uint32_t>(prefetch_distance_arg);
+
   std::string span_server_arg;
   int32_t span_server_port_arg;
   // bool threads_arg;
   uint64_t unique_id_arg;
   uint64_t total_arg;
   uint64_t node_arg;
+  uint64_t learner_threads_arg;
   option_group_definition parallelization_args("Parallelization");
   parallelization_args
       .add(make_option("span_server", span_server_arg).help("Location of server for setting up spanning tree"))
@@ -1547,9 +1646,19 @@ std::unique_ptr<VW::workspace> VW::details::parse_args(std::unique_ptr<options_i
       .add(make_option("node", node_arg).default_value(0).help("Node number in cluster parallel job"))
       .add(make_option("span_server_port", span_server_port_arg)
                .default_value(26543)
-               .help("Port of the server for setting up spanning tree"));
+               .help("Port of the server for setting up spanning tree"))
+      .add(make_option("learner_threads", learner_threads_arg)
+               .default_value(1)
+               .help("Number of threads that learn from the parsed examples at once, Hogwild style, without locking "
+                     "the shared weights. Only plain gd on dense weights is supported"))
+      .add(make_option("instance_threads", all->runtime_config.instance_threads)
+               .help("When several workspaces learn from one input (--args), give each its own learner thread. Set "
+                     "on any of them to enable"));
   all->options->add_and_parse(parallelization_args);
 
+  if (learner_threads_arg == 0) { THROW("learner_threads must be at least 1.") }
+  all->runtime_config.learner_threads = VW::cast_to_smaller_type<size_t>(learner_threads_arg);
+
   // total, unique_id and node must be specified together.
   if ((all->options->was_supplied("total") || all->options->was_supplied("node") ||
           all->options->was_supplied("unique_id")) &&
@@ -1710,9 +1819,23 @@ void VW::details::parse_sources(options_i& options, VW::workspace& all, VW::io_b
 {
   if (!skip_model_load) { load_input_model(all, model); }
   else { model.close_file(); }
+  all.runtime_state.startup_profile.end_phase("load_model");
 
   auto parsed_source_options = parse_source(all, options);
+  const bool packed_predictions = options.get_typed_option<std::string>("predictions_format").value() == "binary";
+  if (all.runtime_config.daemon && (packed_predictions || options.was_supplied("async_predictions")))
+  {
+    THROW("--predictions_format binary and --async_predictions cannot be used in daemon mode");
+  }
+  if (packed_predictions && all.l->get_output_prediction_type() != VW::prediction_type_t::SCALAR)
+  {
+    THROW("--predictions_format binary requires scalar predictions, but the learner predicts "
+        << VW::to_string(all.l->get_output_prediction_type()));
+  }
   enable_sources(all, all.output_config.quiet, all.runtime_config.numpasses, parsed_source_options);
+  // Choosing the example reader resets print_by_ref, so the packed format is set afterwards.
+  if (packed_predictions) { all.print_by_ref = VW::details::print_packed_result_by_ref; }
+  all.runtime_state.startup_profile.end_phase("enable_sources");
 
   // force feature_width to be a power of 2 to avoid 32-bit overflow
   uint32_t interleave_shifts = 0;
@@ -37,38 +37,116 @@
 #include <iostream>
 #include <numeric>
 #include <utility>
+#include <vector>
 
 void initialize_weights_as_polar_normal(VW::weight* weights, uint64_t index)
 {
   weights[0] = VW::details::merand48_boxmuller(index);
 }
 
+namespace
+{
 template <class T>
-double calculate_sd(VW::workspace& /* all */, T& weights)
+double calculate_sd(T& weights)
+{
+  size_t count = 0;
+  double sum = 0.0;
+  for (float v : weights)
+  {
+    count++;
+    sum += v;
+  }
+  const double mean = sum / count;
+  double sq_sum = 0.0;
+  for (float v : weights) { sq_sum += (v - mean) * (v - mean); }
+  return std::sqrt(sq_sum / count);
+}
+
+// Sums are taken per block and added up in block order, which gives the same result for any number of threads.
+double calculate_sd(VW::dense_parameters& weights)
+{
+  const uint64_t count = weights.raw_length() >> weights.stride_shift();
+  const VW::weight* data = weights.data();
+  const uint32_t stride_shift = weights.stride_shift();
+  std::vector<double> block_sums((count + VW::details::PARALLEL_BLOCK_SIZE - 1) / VW::details::PARALLEL_BLOCK_SIZE);
+
+  weights.parallel_for_ranges(
+      [&block_sums, data, stride_shift](uint64_t begin, uint64_t end)
+      {
+        double sum = 0.0;
+        for (uint64_t i = begin; i < end; i++) { sum += data[i << stride_shift]; }
+        block_sums[begin / VW::details::PARALLEL_BLOCK_SIZE] = sum;
+      });
+  const double mean = std::accumulate(block_sums.begin(), block_sums.end(), 0.0) / count;
+
+  weights.parallel_for_ranges(
+      [&block_sums, data, stride_shift, mean](uint64_t begin, uint64_t end)
+      {
+        double sq_sum = 0.0;
+        for (uint64_t i = begin; i < end; i++)
+        {
+          const double diff = data[i << stride_shift] - mean;
+          sq_sum += diff * diff;
+        }
+        block_sums[begin / VW::details::PARALLEL_BLOCK_SIZE] = sq_sum;
+      });
+  return std::sqrt(std::accumulate(block_sums.begin(), block_sums.end(), 0.0) / count);
+}
+
+float truncate_weight(float v, double boundary)
 {
-  static int my_size = 0;
-  std::for_each(weights.begin(), weights.end(), [](float /* v */) { my_size += 1; });
-  double sum = std::accumulate(weights.begin(), weights.end(), 0.0);
-  double mean = sum / my_size;
-  std::vector<double> diff(my_size);
-  std::transform(weights.begin(), weights.end(), diff.begin(), [mean](double x) { return x - mean; });
-  double sq_sum = inner_product(diff.begin(), diff.end(), diff.begin(), 0.0);
-  return std::sqrt(sq_sum / my_size);
+  if (std::fabs(v) > boundary) { return static_cast<float>(std::remainder(static_cast<double>(v), boundary)); }
+  return v;
 }
 
 // re-scaling to re-picking values outside the truncating boundary.
 // note:- boundary is twice the standard deviation.
 template <class T>
-void truncate(VW::workspace& all, T& weights)
+void truncate(T& weights)
 {
-  static double sd = calculate_sd(all, weights);
-  std::for_each(weights.begin(), weights.end(),
-      [](float& v)
+  const double boundary = calculate_sd(weights) * 2;
+  for (float& v : weights) { v = truncate_weight(v, boundary); }
+}
+
+void truncate(VW::dense_parameters& weights)
+{
+  const double boundary = calculate_sd(weights) * 2;
+  VW::weight* data = weights.data();
+  const uint32_t stride_shift = weights.stride_shift();
+  weights.parallel_for_ranges(
+      [data, stride_shift, boundary](uint64_t begin, uint64_t end)
       {
-        if (std::fabs(v) > sd * 2) { v = static_cast<float>(std::remainder(static_cast<double>(v), sd * 2)); }
+        for (uint64_t i = begin; i < end; i++)
+        {
+          VW::weight& w = data[i << stride_shift];
+          w = truncate_weight(w, boundary);
+        }
       });
 }
 
+void allocate_weights(VW::workspace& /* all */, VW::sparse_parameters& weights, size_t length, uint32_t stride_shift)
+{
+  new (&weights) VW::sparse_parameters(length, stride_shift);
+}
+
+void allocate_weights(VW::workspace& all, VW::dense_parameters& weights, size_t length, uint32_t stride_shift)
+{
+  const auto& allocation = all.initial_weights_config.weight_allocation;
+  new (&weights) VW::dense_parameters(length, stride_shift, allocation);
+  weights.prefetch_distance(all.initial_weights_config.prefetch_distance);
+  if (weights.huge_pages() != allocation.huge_pages)
+  {
+    all.logger.err_warn("Could not get {} huge pages for the weight table, it uses {}",
+        allocation.huge_pages == VW::huge_pages_mode::EXPLICIT ? "explicit" : "transparent",
+        weights.huge_pages() == VW::huge_pages_mode::TRANSPARENT ? "transparent huge pages" : "normal pages");
+  }
+  if (!weights.numa_policy_applied())
+  {
+    all.logger.err_warn("Could not apply the --weights_numa policy to the weight table, pages are placed by the OS");
+  }
+}
+}  // namespace
+
 template <class T>
 void initialize_regressor(VW::workspace& all, T& weights)
 {
@@ -80,7 +158,7 @@ void initialize_regressor(VW::workspace& all, T& weights)
   {
     uint32_t ss = weights.stride_shift();
     weights.~T();  // dealloc so that we can realloc, now with a known size
-    new (&weights) T(length, ss);
+    allocate_weights(all, weights, length, ss);
   }
   catch (const VW::vw_exception&)
   {
@@ -96,7 +174,7 @@ void initialize_regressor(VW::workspace& all, T& weights)
   {
     auto initial_value_weight_initializer = [&all](VW::weight* weights, uint64_t /*index*/)
     { weights[0] = all.initial_weights_config.initial_weight; };
-    weights.set_default(initial_value_weight_initializer);
+    weights.set_default_by_index(initial_value_weight_initializer);
   }
   else if (all.initial_weights_config.random_positive_weights)
   {
@@ -110,11 +188,14 @@ void initialize_regressor(VW::workspace& all, T& weights)
     { weights[0] = all.get_random_state()->get_and_update_random() - 0.5f; };
     weights.set_default(random_neg_pos);
   }
-  else if (all.initial_weights_config.normal_weights) { weights.set_default(&initialize_weights_as_polar_normal); }
+  else if (all.initial_weights_config.normal_weights)
+  {
+    weights.set_default_by_index(&initialize_weights_as_polar_normal);
+  }
   else if (all.initial_weights_config.tnormal_weights)
   {
-    weights.set_default(&initialize_weights_as_polar_normal);
-    truncate(all, weights);
+    weights.set_default_by_index(&initialize_weights_as_polar_normal);
+    truncate(weights);
   }
 }
 
@@ -408,6 +489,10 @@ void VW::details::save_load_header(VW::workspace& all, VW::io_buf& model_file, b
         // pushing the contents of buff2 into file_options when it is valid will prevent this false error.
         file_options = file_options + " " + buff2.data();
       }
+
+      // murmur3 is never written to the options (see below), so its absence is what records it. Making it explicit
+      // turns loading such a model with another --hash_algorithm into a disagreeing-option error.
+      if (file_options.find("--hash_algorithm") == std::string::npos) { file_options += " --hash_algorithm murmur3"; }
     }
     else
     {
@@ -419,6 +504,13 @@ void VW::details::save_load_header(VW::workspace& all, VW::io_buf& model_file, b
       {
         if (option->m_keep && options.was_supplied(option->m_name))
         {
+          // Models hashed with murmur3 leave --hash_algorithm out, so they stay identical to models written before
+          // the option existed. The reader above treats a missing value as murmur3.
+          if (option->m_name == "hash_algorithm" &&
+              dynamic_cast<const VW::config::typed_option<std::string>&>(*option).value() == "murmur3")
+          {
+            continue;
+          }
           if (merged_values.find(option->m_name) != merged_values.end())
           {
             // Merge and deduplicate the namespaces before serializing into the model file.
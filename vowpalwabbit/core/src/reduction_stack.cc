@@ -105,6 +105,7 @@
 #include "vw/core/reductions/svrg.h"
 #include "vw/core/reductions/topk.h"
 
+#include <chrono>
 #include <unordered_map>
 
 void register_reductions(std::vector<VW::reduction_setup_fn>& reductions,
@@ -302,7 +303,16 @@ std::shared_ptr<VW::LEARNER::learner> default_reduction_stack_setup::setup_base_
     _feature_width_above *= feature_width;
     // 'hacky' way of keeping track of the option group created by the setup_func about to be created
     _options_impl->tint(setup_func_name);
+    // Reductions set up the ones below them from inside setup_func, so their time is taken out to get this
+    // reduction's own setup time.
+    const auto setup_start = VW::details::startup_profile::clock::now();
+    const double outer_nested_seconds = _nested_setup_seconds;
+    _nested_setup_seconds = 0.0;
     std::shared_ptr<VW::LEARNER::learner> result = setup_func(*this);
+    const double setup_seconds =
+        std::chrono::duration<double>(VW::details::startup_profile::clock::now() - setup_start).count();
+    _all_ptr->runtime_state.startup_profile.add_reduction(setup_func_name, setup_seconds - _nested_setup_seconds);
+    _nested_setup_seconds = outer_nested_seconds + setup_seconds;
     _options_impl->reset_tint();
 
     // returning nullptr means that setup_func (any reduction) was not 'enabled' but
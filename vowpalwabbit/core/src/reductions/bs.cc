@@ -38,6 +38,7 @@ public:
   uint32_t num_bootstrap_rounds = 0;  // number of bootstrap rounds
   size_t bs_type = 0;
   std::vector<double> pred_vec;
+  std::vector<VW::polyprediction> round_preds;
   VW::workspace* all = nullptr;  // for raw prediction and loss
   std::shared_ptr<VW::rand_state> random_state;
 };
@@ -179,19 +180,32 @@ void predict_or_learn(bs_data& d, learner& base, VW::example& ec)
   std::stringstream output_string_stream;
   d.pred_vec.clear();
 
-  for (size_t i = 1; i <= d.num_bootstrap_rounds; i++)
+  if (!is_learn && !should_output)
   {
-    ec.weight = weight_temp * static_cast<float>(bs::weight_gen(*d.random_state));
+    // Predictions do not depend on the importance weight, so every round is scored with one walk over the features.
+    // The weights are still drawn to keep the random state in step with the round-by-round path.
+    for (size_t i = 1; i <= d.num_bootstrap_rounds; i++) { bs::weight_gen(*d.random_state); }
 
-    if (is_learn) { base.learn(ec, i - 1); }
-    else { base.predict(ec, i - 1); }
+    if (d.round_preds.size() < d.num_bootstrap_rounds) { d.round_preds.resize(d.num_bootstrap_rounds); }
+    base.multipredict(ec, 0, d.num_bootstrap_rounds, d.round_preds.data(), true);
+    for (size_t i = 0; i < d.num_bootstrap_rounds; i++) { d.pred_vec.push_back(d.round_preds[i].scalar); }
+  }
+  else
+  {
+    for (size_t i = 1; i <= d.num_bootstrap_rounds; i++)
+    {
+      ec.weight = weight_temp * static_cast<float>(bs::weight_gen(*d.random_state));
 
-    d.pred_vec.push_back(ec.pred.scalar);
+      if (is_learn) { base.learn(ec, i - 1); }
+      else { base.predict(ec, i - 1); }
 
-    if (should_output)
-    {
-      if (i > 1) { output_string_stream << ' '; }
-      output_string_stream << i << ':' << ec.partial_prediction;
+      d.pred_vec.push_back(ec.pred.scalar);
+
+      if (should_output)
+      {
+        if (i > 1) { output_string_stream << ' '; }
+        output_string_stream << i << ':' << ec.partial_prediction;
+      }
     }
   }
 
@@ -280,6 +280,15 @@ void VW::reductions::cb_adf::predict(learner& base, VW::multi_ex& ec_seq)
   details::cs_ldf_learn_or_predict<false>(base, ec_seq, _cb_labels, _cs_labels, _prepped_cs_labels, false, _offset);
 }
 
+void VW::reductions::cb_adf::multipredict(learner& base, VW::multi_ex& ec_seq, size_t count, VW::polyprediction* pred)
+{
+  _offset = ec_seq[0]->ft_offset;
+  _offset_index = _offset / _all->weights.stride();
+  _gen_cs_dr.known_cost = VW::get_observed_cost_or_default_cb_adf(ec_seq);
+  details::gen_cs_test_example(ec_seq, _cs_labels);
+  details::cs_ldf_multipredict(base, ec_seq, _cb_labels, _cs_labels, _prepped_cs_labels, _offset, 0, count, pred);
+}
+
 // how to
 
 bool VW::reductions::cb_adf::update_statistics(
@@ -422,6 +431,12 @@ void learn(VW::reductions::cb_adf& c, learner& base, VW::multi_ex& ec_seq) { c.l
 
 void predict(VW::reductions::cb_adf& c, learner& base, VW::multi_ex& ec_seq) { c.predict(base, ec_seq); }
 
+void multipredict(VW::reductions::cb_adf& c, learner& base, VW::multi_ex& ec_seq, size_t count, size_t /* step */,
+    VW::polyprediction* pred, bool /* finalize_predictions */)
+{
+  c.multipredict(base, ec_seq, count, pred);
+}
+
 }  // namespace
 std::shared_ptr<VW::LEARNER::learner> VW::reductions::cb_adf_setup(VW::setup_base_i& stack_builder)
 {
@@ -519,21 +534,25 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::cb_adf_setup(VW::setup_bas
 
   VW::reductions::cb_adf* bare = ld.get();
   bool lrp = ld->learn_returns_prediction();
-  auto l = make_reduction_learner(std::move(ld), base, learn, predict, stack_builder.get_setupfn_name(cb_adf_setup))
-               .set_input_label_type(VW::label_type_t::CB)
-               .set_output_label_type(VW::label_type_t::CS)
-               .set_input_prediction_type(VW::prediction_type_t::ACTION_SCORES)
-               .set_output_prediction_type(VW::prediction_type_t::ACTION_SCORES)
-               .set_learn_returns_prediction(lrp)
-               .set_feature_width(feature_width)
-               .set_save_load(::save_load)
-               .set_merge(::cb_adf_merge)
-               .set_add(::cb_adf_add)
-               .set_subtract(::cb_adf_subtract)
-               .set_output_example_prediction(::output_example_prediction_cb_adf)
-               .set_print_update(::print_update_cb_adf)
-               .set_update_stats(::update_stats_cb_adf)
-               .build();
+  auto builder =
+      make_reduction_learner(std::move(ld), base, learn, predict, stack_builder.get_setupfn_name(cb_adf_setup))
+          .set_input_label_type(VW::label_type_t::CB)
+          .set_output_label_type(VW::label_type_t::CS)
+          .set_input_prediction_type(VW::prediction_type_t::ACTION_SCORES)
+          .set_output_prediction_type(VW::prediction_type_t::ACTION_SCORES)
+          .set_learn_returns_prediction(lrp)
+          .set_feature_width(feature_width)
+          .set_save_load(::save_load)
+          .set_merge(::cb_adf_merge)
+          .set_add(::cb_adf_add)
+          .set_subtract(::cb_adf_subtract)
+          .set_output_example_prediction(::output_example_prediction_cb_adf)
+          .set_print_update(::print_update_cb_adf)
+          .set_update_stats(::update_stats_cb_adf);
+  // Consecutive offsets above map onto consecutive offsets of the base only when this learner uses a single weight
+  // vector; with dr the learner falls back to one predict per offset.
+  if (feature_width == 1) { builder.set_multipredict(::multipredict); }
+  auto l = builder.build();
 
   bare->set_scorer(VW::LEARNER::require_singleline(base->get_learner_by_name_prefix("scorer")));
 
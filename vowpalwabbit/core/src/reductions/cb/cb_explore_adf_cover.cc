@@ -65,6 +65,7 @@ private:
   VW::cs_label _cs_labels_2;
   std::vector<VW::cs_label> _prepped_cs_labels;
   std::vector<VW::cb_label> _cb_labels;
+  std::vector<VW::polyprediction> _cover_preds;
   template <bool is_learn>
   void predict_or_learn_impl(VW::LEARNER::learner& base, VW::multi_ex& examples);
 };
@@ -148,6 +149,16 @@ void cb_explore_adf_cover::predict_or_learn_impl(VW::LEARNER::learner& base, VW:
   else { _action_probs[preds[0].action].score += additive_probability; }
 
   float norm = min_prob * num_actions + (additive_probability - min_prob);
+
+  // The policies other than the first do not depend on each other when predicting, so they are scored at their
+  // offsets 2.._cover_size with one walk over each action's features.
+  if (!is_learn && _cover_size > 1)
+  {
+    if (_cover_preds.size() < _cover_size - 1) { _cover_preds.resize(_cover_size - 1); }
+    VW::details::cs_ldf_multipredict(*(_cs_ldf_learner), examples, _cb_labels, _cs_labels, _prepped_cs_labels,
+        examples[0]->ft_offset, 2, _cover_size - 1, _cover_preds.data());
+  }
+
   for (size_t i = 1; i < _cover_size; i++)
   {
     // Create costs of each action based on online cover
@@ -169,30 +180,27 @@ void cb_explore_adf_cover::predict_or_learn_impl(VW::LEARNER::learner& base, VW:
       VW::details::cs_ldf_learn_or_predict<true>(*(_cs_ldf_learner), examples, _cb_labels, _cs_labels_2,
           _prepped_cs_labels, true, examples[0]->ft_offset, i + 1);
     }
-    else
-    {
-      VW::details::cs_ldf_learn_or_predict<false>(*(_cs_ldf_learner), examples, _cb_labels, _cs_labels,
-          _prepped_cs_labels, false, examples[0]->ft_offset, i + 1);
-    }
+    // When predicting, the policies were all scored before the loop.
+    const VW::v_array<VW::action_score>& policy_preds = is_learn ? preds : _cover_preds[i - 1].a_s;
 
-    for (uint32_t j = 0; j < num_actions; j++) { _scores[j] += preds[j].score; }
+    for (uint32_t j = 0; j < num_actions; j++) { _scores[j] += policy_preds[j].score; }
     if (!_first_only)
     {
-      size_t tied_actions = fill_tied(preds);
+      size_t tied_actions = fill_tied(policy_preds);
       const float add_prob = additive_probability / tied_actions;
       for (size_t j = 0; j < tied_actions; ++j)
       {
-        if (_action_probs[preds[j].action].score < min_prob)
+        if (_action_probs[policy_preds[j].action].score < min_prob)
         {
-          norm += (std::max)(0.f, add_prob - (min_prob - _action_probs[preds[j].action].score));
+          norm += (std::max)(0.f, add_prob - (min_prob - _action_probs[policy_preds[j].action].score));
         }
         else { norm += add_prob; }
-        _action_probs[preds[j].action].score += add_prob;
+        _action_probs[policy_preds[j].action].score += add_prob;
       }
     }
     else
     {
-      uint32_t action = preds[0].action;
+      uint32_t action = policy_preds[0].action;
       if (_action_probs[action].score < min_prob)
       {
         norm += (std::max)(0.f, additive_probability - (min_prob - _action_probs[action].score));
@@ -48,10 +48,13 @@ public:
   VW::workspace* all = nullptr;
 
   bool rank = false;
+  // Set when the base scores with the identity link, so a fused multipredict yields the raw scores.
+  bool identity_link = true;
   VW::action_scores a_s;
   uint64_t ft_offset = 0;
 
   std::vector<VW::action_scores> stored_preds;
+  std::vector<VW::polyprediction> multipredict_preds;
 };
 
 inline bool cmp_wclass_ptr(const VW::cs_class* a, const VW::cs_class* b) { return a->x < b->x; }
@@ -135,6 +138,29 @@ void make_single_prediction(ldf& data, learner& base, VW::example& ec)
   base.predict(ec);  // make a prediction
 }
 
+// Same as make_single_prediction, but scores the offsets 0..count-1 with one walk over the features of ec. The score
+// of offset c is left in data.multipredict_preds[c]. The base applies its link to these scores, so this matches the
+// raw partial_prediction of make_single_prediction only under the identity link.
+void make_single_multiprediction(ldf& data, learner& base, VW::example& ec, size_t count)
+{
+  uint64_t old_offset = ec.ft_offset;
+
+  VW::details::append_example_namespace_from_memory(data.label_features, ec, ec.l.cs.costs[0].class_index);
+
+  auto restore_guard = VW::scope_exit(
+      [&data, old_offset, &ec]
+      {
+        ec.ft_offset = old_offset;
+        VW::details::truncate_example_namespace_from_memory(data.label_features, ec, ec.l.cs.costs[0].class_index);
+      });
+
+  ec.l.simple = VW::simple_label{FLT_MAX};
+  ec.ex_reduction_features.template get<VW::simple_label_reduction_features>().reset_to_default();
+
+  ec.ft_offset = data.ft_offset;
+  base.multipredict(ec, 0, count, data.multipredict_preds.data(), false);
+}
+
 bool test_ldf_sequence(const VW::multi_ex& ec_seq, VW::io::logger& logger)
 {
   bool is_test;
@@ -429,6 +455,46 @@ void predict_csoaa_ldf_rank(ldf& data, learner& base, VW::multi_ex& ec_seq_all)
   }
 }
 
+// Ranks the actions for count consecutive offsets, writing the sorted action scores of offset c to pred[c].a_s.
+// The scores are the raw partial predictions, as in predict_csoaa_ldf_rank. Only the identity link lets one walk
+// over the features produce them; otherwise each offset is predicted in turn. The examples' own predictions and
+// label partial predictions are left untouched.
+void multipredict_csoaa_ldf_rank(ldf& data, learner& base, VW::multi_ex& ec_seq_all, size_t count, size_t step,
+    VW::polyprediction* pred, bool /* finalize_predictions */)
+{
+  for (size_t c = 0; c < count; c++) { pred[c].a_s.clear(); }
+  if (ec_seq_all.empty() || count == 0) { return; }
+
+  data.ft_offset = ec_seq_all[0]->ft_offset;
+  if (data.multipredict_preds.size() < count) { data.multipredict_preds.resize(count); }
+
+  for (auto* ec : ec_seq_all)
+  {
+    const uint32_t action = ec->l.cs.costs[0].class_index;
+    if (data.identity_link) { make_single_multiprediction(data, base, *ec, count); }
+    else
+    {
+      const float saved_cost_prediction = ec->l.cs.costs[0].partial_prediction;
+      const float saved_partial_prediction = ec->partial_prediction;
+      const float saved_scalar = ec->pred.scalar;
+      const uint64_t first_offset = data.ft_offset;
+      for (size_t c = 0; c < count; c++)
+      {
+        data.ft_offset = first_offset + c * step;
+        make_single_prediction(data, base, *ec);
+        data.multipredict_preds[c].scalar = ec->partial_prediction;
+      }
+      data.ft_offset = first_offset;
+      ec->l.cs.costs[0].partial_prediction = saved_cost_prediction;
+      ec->partial_prediction = saved_partial_prediction;
+      ec->pred.scalar = saved_scalar;
+    }
+    for (size_t c = 0; c < count; c++) { pred[c].a_s.push_back({action, data.multipredict_preds[c].scalar}); }
+  }
+
+  for (size_t c = 0; c < count; c++) { std::sort(pred[c].a_s.begin(), pred[c].a_s.end()); }
+}
+
 void csoaa_ldf_multiclass_printline(
     VW::workspace& all, VW::io::writer* output, const VW::multi_ex& ec_seq, VW::io::logger& logger)
 {
@@ -769,6 +835,9 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::csldf_setup(VW::setup_base
   ld->label_features.reserve(256);
 
   auto base = require_singleline(stack_builder.setup_base_learner());
+  // The scorer below has registered --link by now; it defaults to identity.
+  ld->identity_link =
+      !options.was_supplied("link") || options.get_typed_option<std::string>("link").value() == "identity";
   VW::learner_update_stats_func<ldf, VW::multi_ex>* update_stats_func = nullptr;
   VW::learner_output_example_prediction_func<ldf, VW::multi_ex>* output_example_prediction_func = nullptr;
   VW::learner_print_update_func<ldf, VW::multi_ex>* print_update_func = nullptr;
@@ -805,15 +874,16 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::csldf_setup(VW::setup_base
     print_update_func = print_update_csoaa_ldf_multiclass;
   }
 
-  auto l = make_reduction_learner(std::move(ld), base, learn_csoaa_ldf, pred_ptr, name + name_addition)
-               .set_end_pass(end_pass)
-               .set_input_label_type(VW::label_type_t::CS)
-               .set_output_label_type(VW::label_type_t::SIMPLE)
-               .set_input_prediction_type(VW::prediction_type_t::SCALAR)
-               .set_output_prediction_type(pred_type)
-               .set_update_stats(update_stats_func)
-               .set_output_example_prediction(output_example_prediction_func)
-               .set_print_update(print_update_func)
-               .build();
-  return l;
+  const bool rank = ld->rank;
+  auto builder = make_reduction_learner(std::move(ld), base, learn_csoaa_ldf, pred_ptr, name + name_addition)
+                     .set_end_pass(end_pass)
+                     .set_input_label_type(VW::label_type_t::CS)
+                     .set_output_label_type(VW::label_type_t::SIMPLE)
+                     .set_input_prediction_type(VW::prediction_type_t::SCALAR)
+                     .set_output_prediction_type(pred_type)
+                     .set_update_stats(update_stats_func)
+                     .set_output_example_prediction(output_example_prediction_func)
+                     .set_print_update(print_update_func);
+  if (rank) { builder.set_multipredict(multipredict_csoaa_ldf_rank); }
+  return builder.build();
 }
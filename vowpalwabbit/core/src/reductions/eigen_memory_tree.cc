@@ -29,7 +29,6 @@
 #include <cmath>
 #include <cstdio>
 #include <ctime>
-#include <list>
 #include <memory>
 #include <sstream>
 #include <type_traits>
@@ -81,9 +80,9 @@ emt_initial_type emt_initial_type_from_string(VW::string_view val)
   THROW(fmt::format("{} is not valid emt_initial_type", val));
 }
 
-float emt_initial(emt_initial_type initial_type, emt_feats f1, emt_feats f2)
+float emt_initial(emt_initial_type initial_type, const emt_feats& f1, const emt_feats& f2)
 {
-  if (initial_type == emt_initial_type::GAUSSIAN) { return 1 - std::exp(-emt_norm(emt_scale_add(1, f1, -1, f2))); }
+  if (initial_type == emt_initial_type::GAUSSIAN) { return 1 - std::exp(-emt_distance(f1, f2)); }
 
   if (initial_type == emt_initial_type::COSINE)
   {
@@ -93,65 +92,86 @@ float emt_initial(emt_initial_type initial_type, emt_feats f1, emt_feats f2)
     {
       // cosine distance isn't defined for vectors of size 0 so
       // we default to a gaussian loss as a fallback distance
-      return 1 - std::exp(-emt_norm(emt_scale_add(1, f1, -1, f2)));
+      return 1 - std::exp(-emt_distance(f1, f2));
     }
   }
 
-  if (initial_type == emt_initial_type::EUCLIDEAN) { return emt_norm(emt_scale_add(1, f1, -1, f2)); }
+  if (initial_type == emt_initial_type::EUCLIDEAN) { return emt_distance(f1, f2); }
 
   return 0;
 }
 
 emt_example::emt_example(VW::workspace& all, VW::example* ex)
+{
+  VW::features fs;
+  fill(all, ex, fs);
+}
+
+void emt_example::fill(VW::workspace& all, VW::example* ex, VW::features& flat_scratch)
 {
   label = ex->l.multi.label;
+  base.clear();
+  full.clear();
 
   std::vector<std::vector<VW::namespace_index>>* full_interactions = ex->interactions;
   std::vector<std::vector<VW::namespace_index>> base_interactions;
 
   ex->interactions = &base_interactions;
-  VW::features fs;
-  VW::flatten_features(all, *ex, fs);
-  for (auto& f : fs) { base.emplace_back(f.index(), f.value()); }
+  flat_scratch.clear();
+  VW::flatten_features(all, *ex, flat_scratch);
+  for (auto& f : flat_scratch) { base.emplace_back(f.index(), f.value()); }
 
-  fs.clear();
+  flat_scratch.clear();
   ex->interactions = full_interactions;
-  VW::flatten_features(all, *ex, fs);
-  for (auto& f : fs) { full.emplace_back(f.index(), f.value()); }
+  VW::flatten_features(all, *ex, flat_scratch);
+  for (auto& f : flat_scratch) { full.emplace_back(f.index(), f.value()); }
 }
 
 emt_lru::emt_lru(uint64_t max_size) : max_size(max_size) {}
 
+void emt_lru::erase(emt_lru::K item)
+{
+  if (item >= links.size() || !links[item].linked) { return; }
+
+  auto& l = links[item];
+  if (l.prev != EMT_NULL_INDEX) { links[l.prev].next = l.next; }
+  else { head = l.next; }
+  if (l.next != EMT_NULL_INDEX) { links[l.next].prev = l.prev; }
+  else { tail = l.prev; }
+
+  l = link{};
+  count--;
+}
+
 emt_lru::K emt_lru::bound(emt_lru::K item)
 {
-  if (max_size == 0) { return nullptr; }
+  if (max_size == 0) { return EMT_NULL_INDEX; }
 
-  auto item_map_reference = map.find(item);
+  if (item >= links.size()) { links.resize(static_cast<size_t>(item) + 1); }
 
-  // item is not in map so we add it to our list
-  if (item_map_reference == map.end())
+  // item is already in the list so we move it to the front of the line
+  if (links[item].linked)
   {
-    list.push_front(item);
-    map.emplace(std::pair<K, V>(item, list.begin()));
-  }
-  // item is in map already so we move it to the front of the line
-  else
-  {
-    auto item_list_reference = (*item_map_reference).second;
-    if (item_list_reference != list.begin())
-    {
-      list.splice(list.begin(), list, item_list_reference, std::next(item_list_reference));
-    }
+    if (head == item) { return EMT_NULL_INDEX; }
+    erase(item);
   }
 
-  if (list.size() > max_size)
+  auto& l = links[item];
+  l.prev = EMT_NULL_INDEX;
+  l.next = head;
+  l.linked = true;
+  if (head != EMT_NULL_INDEX) { links[head].prev = item; }
+  head = item;
+  if (tail == EMT_NULL_INDEX) { tail = item; }
+  count++;
+
+  if (count > max_size)
   {
-    K last_value = list.back();
-    list.pop_back();
-    map.erase(last_value);
+    K last_value = tail;
+    erase(last_value);
     return last_value;
   }
-  return nullptr;
+  return EMT_NULL_INDEX;
 }
 
 emt_tree::emt_tree(VW::workspace* all, std::shared_ptr<VW::rand_state> random_state, uint32_t leaf_split,
@@ -164,7 +184,7 @@ emt_tree::emt_tree(VW::workspace* all, std::shared_ptr<VW::rand_state> random_st
     , initial_type(initial_type)
 {
   bounder = VW::make_unique<VW::reductions::eigen_memory_tree::emt_lru>(tree_bound);
-  root = VW::make_unique<emt_node>();
+  nodes.emplace_back();
 
   // we set this up for repeated use later in the scorer.
   // we will populate this examples features over and over.
@@ -228,6 +248,28 @@ float emt_norm(const emt_feats& xs)
   return std::sqrt(sum_weights_sq);
 }
 
+// Equal to emt_norm(emt_sub(f1, f2)), summed in the same order, without materializing the difference.
+float emt_distance(const emt_feats& f1, const emt_feats& f2)
+{
+  float sum_sq = 0;
+  auto iter1 = f1.begin();
+  auto iter2 = f2.begin();
+
+  while (iter1 != f1.end() && iter2 != f2.end())
+  {
+    float diff;
+    if (iter1->first < iter2->first) { diff = (iter1++)->second; }
+    else if (iter2->first < iter1->first) { diff = -(iter2++)->second; }
+    else { diff = (iter1++)->second - (iter2++)->second; }
+    sum_sq += diff * diff;
+  }
+
+  for (; iter1 != f1.end(); iter1++) { sum_sq += iter1->second * iter1->second; }
+  for (; iter2 != f2.end(); iter2++) { sum_sq += iter2->second * iter2->second; }
+
+  return std::sqrt(sum_sq);
+}
+
 void emt_scale(emt_feats& xs, float scalar)
 {
   for (auto& x : xs) { x.second *= scalar; }
@@ -459,34 +501,48 @@ emt_feats emt_router(std::vector<emt_feats>& exs, emt_router_type router_type, V
 
 ////////////////////////eigen_memory_tree///////////////////
 ////////////////////////////////////////////////////////////
-emt_node* node_route(emt_node& cn, emt_example& ec)
+emt_index node_route(const emt_node& cn, const emt_example& ec)
 {
-  return emt_inner(ec.base, cn.router_weights) < cn.router_decision ? cn.left.get() : cn.right.get();
+  return emt_inner(ec.base, cn.router_weights) < cn.router_decision ? cn.left : cn.right;
 }
 
-emt_node* tree_route(emt_tree& b, emt_example& ec)
+emt_index tree_route(const emt_tree& b, const emt_example& ec)
 {
-  emt_node* cn = b.root.get();
-  while (cn->left != nullptr) { cn = node_route(*cn, ec); }
-  return cn;
+  emt_index i = 0;
+  while (!b.nodes[i].is_leaf()) { i = node_route(b.nodes[i], ec); }
+  return i;
 }
 
-void tree_bound(emt_tree& b, emt_example* ec)
+emt_index example_alloc(emt_tree& b)
 {
-  emt_example* to_delete = b.bounder->bound(ec);
+  if (!b.free_examples.empty())
+  {
+    emt_index slot = b.free_examples.back();
+    b.free_examples.pop_back();
+    return slot;
+  }
 
-  if (to_delete == nullptr) { return; }
+  b.examples.emplace_back();
+  b.example_leaf.push_back(EMT_NULL_INDEX);
+  return static_cast<emt_index>(b.examples.size() - 1);
+}
 
-  emt_node& cn = *tree_route(b, *to_delete);
+void example_release(emt_tree& b, emt_index slot)
+{
+  b.example_leaf[slot] = EMT_NULL_INDEX;
+  b.free_examples.push_back(slot);
+}
 
-  for (auto iter = cn.examples.begin(); iter != cn.examples.end(); iter++)
-  {
-    if (iter->get() == to_delete)
-    {
-      cn.examples.erase(iter);
-      return;
-    }
-  }
+void tree_bound(emt_tree& b, emt_index slot)
+{
+  emt_index to_delete = b.bounder->bound(slot);
+
+  if (to_delete == EMT_NULL_INDEX) { return; }
+
+  auto& leaf_examples = b.nodes[b.example_leaf[to_delete]].examples;
+  auto iter = std::find(leaf_examples.begin(), leaf_examples.end(), to_delete);
+  if (iter != leaf_examples.end()) { leaf_examples.erase(iter); }
+  example_release(b, to_delete);
 }
 
 void scorer_features(const emt_feats& f1, VW::features& out)
@@ -535,15 +591,61 @@ void scorer_features(const emt_feats& f1, const emt_feats& f2, VW::features& out
   }
 }
 
-void scorer_example(emt_tree& b, const emt_example& ex1, const emt_example& ex2)
+constexpr VW::namespace_index X_NS = 'x';
+constexpr VW::namespace_index Z_NS = 'z';
+
+// Minimum number of candidates per task submitted to the scan pool.
+constexpr size_t SCAN_BLOCK_SIZE = 32;
+
+// Builds the scorer features comparing ex1 to ex2 into out. This only reads the tree so that the candidates of a
+// leaf can be prepared concurrently.
+void scorer_prepare(const emt_tree& b, const emt_example& ex1, const emt_example& ex2, emt_scorer_candidate& out)
 {
-  VW::example& out = *b.ex;
+  out.x.clear();
+  out.z.clear();
+
+  if (b.scorer_type == emt_scorer_type::SELF_CONSISTENT_RANK) { scorer_features(ex1.full, ex2.full, out.x); }
+
+  if (b.scorer_type == emt_scorer_type::NOT_SELF_CONSISTENT_RANK)
+  {
+    scorer_features(ex1.full, out.x);
+    scorer_features(ex2.full, out.z);
 
-  static constexpr VW::namespace_index X_NS = 'x';
-  static constexpr VW::namespace_index Z_NS = 'z';
+    // when we receive ex1 and ex2 their features are indexed on top of eachother. In order
+    // to make sure VW recognizes the features from the two examples as separate features
+    // we apply a map of multiplying by 2 and then offseting by 1 on the second example.
+    for (auto& j : out.x.indices) { j = j * 2; }
+    for (auto& j : out.z.indices) { j = j * 2 + 1; }
+  }
+
+  // We cache metadata about model weights adjacent to them. For example if we have
+  // a model weight w[i] then we may also store information about our confidence in
+  // w[i] at w[i+1] and information about the scale of feature f[i] at w[i+2] and so on.
+  // This variable indicates how many such meta-data places we need to save in between actual weights.
+  uint64_t floats_per_feature_index = static_cast<uint64_t>(b.all->reduction_state.total_feature_width)
+      << b.all->weights.stride_shift();
+
+  // In both of the example_types above we construct our scorer_example from flat_examples. The VW routine
+  // which creates flat_examples removes the floats_per_feature_index from the when flattening. Therefore,
+  // we need to manually add it back to make sure our base learner doesn't overwrite our features/weights
+  // with metadata.
+  if (floats_per_feature_index != 1)
+  {
+    for (auto& j : out.x.indices) { j *= floats_per_feature_index; }
+    for (auto& j : out.z.indices) { j *= floats_per_feature_index; }
+  }
+
+  out.initial = emt_initial(b.initial_type, ex1.full, ex2.full);
+}
+
+// Moves a prepared candidate into the reusable scorer example. The candidate is left holding the previous
+// feature buffers so that no allocation happens when it is prepared again.
+void scorer_load(emt_tree& b, emt_scorer_candidate& c)
+{
+  VW::example& out = *b.ex;
 
-  out.feature_space[X_NS].clear();
-  out.feature_space[Z_NS].clear();
+  std::swap(out.feature_space[X_NS], c.x);
+  std::swap(out.feature_space[Z_NS], c.z);
 
   if (b.scorer_type == emt_scorer_type::SELF_CONSISTENT_RANK)
   {
@@ -552,13 +654,8 @@ void scorer_example(emt_tree& b, const emt_example& ex1, const emt_example& ex2)
 
     out.interactions->clear();
 
-    scorer_features(ex1.full, ex2.full, out.feature_space[X_NS]);
-
     out.total_sum_feat_sq = out.feature_space[X_NS].sum_feat_sq;
     out.num_features = out.feature_space[X_NS].size();
-
-    auto initial = emt_initial(b.initial_type, ex1.full, ex2.full);
-    out.ex_reduction_features.get<VW::simple_label_reduction_features>().initial = initial;
   }
 
   if (b.scorer_type == emt_scorer_type::NOT_SELF_CONSISTENT_RANK)
@@ -574,63 +671,86 @@ void scorer_example(emt_tree& b, const emt_example& ex1, const emt_example& ex2)
     b.all->feature_tweaks_config.ignore_linear[X_NS] = true;
     b.all->feature_tweaks_config.ignore_linear[Z_NS] = true;
 
-    scorer_features(ex1.full, out.feature_space[X_NS]);
-    scorer_features(ex2.full, out.feature_space[Z_NS]);
-
-    // when we receive ex1 and ex2 their features are indexed on top of eachother. In order
-    // to make sure VW recognizes the features from the two examples as separate features
-    // we apply a map of multiplying by 2 and then offseting by 1 on the second example.
-    for (auto& j : out.feature_space[X_NS].indices) { j = j * 2; }
-    for (auto& j : out.feature_space[Z_NS].indices) { j = j * 2 + 1; }
-
     out.total_sum_feat_sq = out.feature_space[X_NS].sum_feat_sq + out.feature_space[Z_NS].sum_feat_sq;
     out.num_features = out.feature_space[X_NS].size() + out.feature_space[Z_NS].size();
-
-    auto initial = emt_initial(b.initial_type, ex1.full, ex2.full);
-    out.ex_reduction_features.get<VW::simple_label_reduction_features>().initial = initial;
   }
 
-  // We cache metadata about model weights adjacent to them. For example if we have
-  // a model weight w[i] then we may also store information about our confidence in
-  // w[i] at w[i+1] and information about the scale of feature f[i] at w[i+2] and so on.
-  // This variable indicates how many such meta-data places we need to save in between actual weights.
-  uint64_t floats_per_feature_index = static_cast<uint64_t>(b.all->reduction_state.total_feature_width)
-      << b.all->weights.stride_shift();
+  out.ex_reduction_features.get<VW::simple_label_reduction_features>().initial = c.initial;
+}
 
-  // In both of the example_types above we construct our scorer_example from flat_examples. The VW routine
-  // which creates flat_examples removes the floats_per_feature_index from the when flattening. Therefore,
-  // we need to manually add it back to make sure our base learner doesn't overwrite our features/weights
-  // with metadata.
-  if (floats_per_feature_index != 1)
+void scorer_example(emt_tree& b, const emt_example& ex1, const emt_example& ex2)
+{
+  scorer_prepare(b, ex1, ex2, b.learn_candidate);
+  scorer_load(b, b.learn_candidate);
+}
+
+void leaf_prepare_block(
+    const emt_tree& b, const emt_example& ex, const emt_index* slots, size_t begin, size_t end, emt_scorer_candidate* out)
+{
+  for (size_t i = begin; i < end; i++)
   {
-    for (VW::features& fs : out)
+    const emt_example& leaf_ex = b.examples[slots[i]];
+    emt_scorer_candidate& c = out[i];
+
+    if (b.scorer_type == emt_scorer_type::DISTANCE)
     {
-      for (auto& j : fs.indices) { j *= floats_per_feature_index; }
+      c.score = emt_initial(b.initial_type, ex.full, leaf_ex.full);
+      continue;
     }
+
+    // The features matched exactly. Return max negative to make sure it is picked.
+    // Do I want this here? It doesn't seem to matter on experimental datasets.
+    c.exact_match = ex.full == leaf_ex.full;
+    if (c.exact_match) { c.score = -FLT_MAX; }
+    else { scorer_prepare(b, ex, leaf_ex, c); }
   }
 }
 
-float scorer_predict(emt_tree& b, learner& base, const emt_example& pred_ex, const emt_example& leaf_ex)
+// Scores every memory of leaf against ex into b.candidates, in the order of the leaf's examples. Building the
+// scorer features is independent per memory and is fanned out over the scan pool for large leaves. The base
+// learner is then run over the prepared candidates on this thread.
+void leaf_scores(emt_tree& b, learner& base, emt_index leaf, const emt_example& ex)
 {
-  if (b.scorer_type == emt_scorer_type::RANDOM)  // random scorer
+  const auto& slots = b.nodes[leaf].examples;
+  const size_t count = slots.size();
+  if (b.candidates.size() < count) { b.candidates.resize(count); }
+
+  if (b.scorer_type == emt_scorer_type::RANDOM)
   {
-    return b.random_state->get_and_update_random();
+    for (size_t i = 0; i < count; i++) { b.candidates[i].score = b.random_state->get_and_update_random(); }
+    return;
   }
 
-  if (b.scorer_type == emt_scorer_type::DISTANCE)  // dist scorer
+  const size_t num_threads = b.scan_pool == nullptr ? 0 : b.scan_pool->size();
+  if (num_threads == 0 || count < 2 * SCAN_BLOCK_SIZE)
   {
-    return emt_initial(b.initial_type, pred_ex.full, leaf_ex.full);
+    leaf_prepare_block(b, ex, slots.data(), 0, count, b.candidates.data());
+  }
+  else
+  {
+    const size_t block_size = std::max(SCAN_BLOCK_SIZE, (count + num_threads - 1) / num_threads);
+    for (size_t block_begin = 0; block_begin < count; block_begin += block_size)
+    {
+      const size_t block_end = std::min(count, block_begin + block_size);
+      b.scan_futures.emplace_back(b.scan_pool->submit(leaf_prepare_block, std::cref(b), std::cref(ex), slots.data(),
+          block_begin, block_end, b.candidates.data()));
+    }
+    for (auto& future : b.scan_futures) { future.get(); }
+    b.scan_futures.clear();
   }
 
-  // The features matched exactly. Return max negative to make sure it is picked.
-  // Do I want this here? It doesn't seem to matter on experimental datasets.
-  if (pred_ex.full == leaf_ex.full) { return -FLT_MAX; }
+  if (b.scorer_type == emt_scorer_type::DISTANCE) { return; }
 
-  scorer_example(b, pred_ex, leaf_ex);
-  b.ex->l.simple = {FLT_MAX};
-  base.predict(*b.ex);
+  for (size_t i = 0; i < count; i++)
+  {
+    emt_scorer_candidate& c = b.candidates[i];
+    if (c.exact_match) { continue; }
 
-  return b.ex->pred.scalar;
+    scorer_load(b, c);
+    b.ex->l.simple = {FLT_MAX};
+    base.predict(*b.ex);
+    c.score = b.ex->pred.scalar;
+  }
 }
 
 void scorer_learn(learner& base, VW::example& ex, float label, float weight)
@@ -644,12 +764,13 @@ void scorer_learn(learner& base, VW::example& ex, float label, float weight)
   }
 }
 
-void scorer_learn(emt_tree& b, learner& base, emt_node& cn, const emt_example& ex, float weight)
+void scorer_learn(emt_tree& b, learner& base, emt_index leaf, const emt_example& ex, float weight)
 {
   // random and dist scorer has nothing to learn
   if (b.scorer_type == emt_scorer_type::RANDOM || b.scorer_type == emt_scorer_type::DISTANCE) { return; }
 
   if (weight == 0) { return; }
+  auto& cn = b.nodes[leaf];
   if (cn.examples.size() < 2) { return; }
 
   // shuffle the examples to break ties randomly
@@ -657,35 +778,36 @@ void scorer_learn(emt_tree& b, learner& base, emt_node& cn, const emt_example& e
 
   float preferred_score = FLT_MAX;
   float preferred_error = FLT_MAX;
-  emt_example* preferred_ex = nullptr;
+  const emt_example* preferred_ex = nullptr;
 
   float alternative_score = FLT_MAX;
   float alternative_error = FLT_MAX;
-  emt_example* alternative_ex = nullptr;
+  const emt_example* alternative_ex = nullptr;
 
-  std::vector<float> scores;
-  for (auto& example : cn.examples) { scores.push_back(scorer_predict(b, base, ex, *example)); }
+  leaf_scores(b, base, leaf, ex);
 
   // double loop has time complexity of 2n which is almost always faster than a sort with n*log(n)
   for (size_t i = 0; i < cn.examples.size(); i++)
   {
-    if (scores[i] < preferred_score)
+    if (b.candidates[i].score < preferred_score)
     {
-      preferred_score = scores[i];
-      preferred_ex = cn.examples[i].get();
+      preferred_score = b.candidates[i].score;
+      preferred_ex = &b.examples[cn.examples[i]];
       preferred_error = (preferred_ex->label == ex.label) ? 0.f : 1.f;
     }
   }
 
   for (size_t i = 0; i < cn.examples.size(); i++)
   {
-    if (cn.examples[i].get() == preferred_ex) { continue; }
-    float error = (cn.examples[i].get()->label == ex.label) ? 0.f : 1.f;
+    const emt_example* candidate = &b.examples[cn.examples[i]];
+    if (candidate == preferred_ex) { continue; }
+    float error = (candidate->label == ex.label) ? 0.f : 1.f;
 
-    if ((error < alternative_error) || (error == alternative_error && scores[i] < alternative_score))
+    float score = b.candidates[i].score;
+    if ((error < alternative_error) || (error == alternative_error && score < alternative_score))
     {
-      alternative_score = scores[i];
-      alternative_ex = cn.examples[i].get();
+      alternative_score = score;
+      alternative_ex = candidate;
       alternative_error = error;
     }
   }
@@ -720,15 +842,22 @@ void scorer_learn(emt_tree& b, learner& base, emt_node& cn, const emt_example& e
   }
 }
 
-void node_split(emt_tree& b, emt_node& cn)
+void node_split(emt_tree& b, emt_index leaf)
 {
-  if (cn.examples.size() <= b.leaf_split) { return; }
+  if (b.nodes[leaf].examples.size() <= b.leaf_split) { return; }
 
   std::vector<emt_feats> exs;
-  for (auto& ex : cn.examples) { exs.push_back(ex->base); }
+  exs.reserve(b.nodes[leaf].examples.size());
+  for (auto slot : b.nodes[leaf].examples) { exs.push_back(b.examples[slot].base); }
 
-  cn.left = VW::make_unique<emt_node>();
-  cn.right = VW::make_unique<emt_node>();
+  // growing the node slab invalidates references so the children are allocated before cn is taken
+  auto left = static_cast<emt_index>(b.nodes.size());
+  b.nodes.emplace_back();
+  b.nodes.emplace_back();
+
+  emt_node& cn = b.nodes[leaf];
+  cn.left = left;
+  cn.right = left + 1;
   cn.router_weights = emt_router(exs, b.router_type, *b.random_state);
 
   std::vector<float> projs;
@@ -737,46 +866,60 @@ void node_split(emt_tree& b, emt_node& cn)
 
   cn.router_decision = emt_median(projs);
 
-  for (auto& ex : cn.examples) { node_route(cn, *ex)->examples.push_back(std::move(ex)); }
+  for (auto slot : cn.examples)
+  {
+    emt_index child = node_route(cn, b.examples[slot]);
+    b.nodes[child].examples.push_back(slot);
+    b.example_leaf[slot] = child;
+  }
   cn.examples.clear();
+  cn.examples.shrink_to_fit();
 }
 
-void node_insert(emt_node& cn, std::unique_ptr<emt_example> ex)
+// Returns the slot of a memory in leaf with exactly the same features as the memory in slot, if there is one.
+emt_index node_find_duplicate(const emt_tree& b, emt_index leaf, emt_index slot)
 {
-  for (auto& cn_ex : cn.examples)
+  for (auto cn_slot : b.nodes[leaf].examples)
   {
-    if (cn_ex->full == ex->full) { return; }
+    if (b.examples[cn_slot].full == b.examples[slot].full) { return cn_slot; }
   }
-  cn.examples.push_back(std::move(ex));
+  return EMT_NULL_INDEX;
 }
 
-emt_example* node_pick(emt_tree& b, learner& base, emt_node& cn, const emt_example& ex)
+void node_insert(emt_tree& b, emt_index leaf, emt_index slot)
 {
+  b.nodes[leaf].examples.push_back(slot);
+  b.example_leaf[slot] = leaf;
+}
+
+const emt_example* node_pick(emt_tree& b, learner& base, emt_index leaf, const emt_example& ex)
+{
+  auto& cn = b.nodes[leaf];
   if (cn.examples.empty()) { return nullptr; }
 
   float best_score = FLT_MAX;
-  emt_example* best_example = cn.examples[0].get();
+  const emt_example* best_example = &b.examples[cn.examples[0]];
 
   // shuffle the examples to break ties randomly
   emt_shuffle(cn.examples.begin(), cn.examples.end(), *b.random_state);
 
-  for (auto const& example : cn.examples)
-  {
-    float score = scorer_predict(b, base, ex, *example);
+  leaf_scores(b, base, leaf, ex);
 
-    if (score < best_score)
+  for (size_t i = 0; i < cn.examples.size(); i++)
+  {
+    if (b.candidates[i].score < best_score)
     {
-      best_score = score;
-      best_example = example.get();
+      best_score = b.candidates[i].score;
+      best_example = &b.examples[cn.examples[i]];
     }
   }
 
   return best_example;
 }
 
-void node_predict(emt_tree& b, learner& base, emt_node& cn, emt_example& ex, VW::example& ec)
+void node_predict(emt_tree& b, learner& base, emt_index leaf, const emt_example& ex, VW::example& ec)
 {
-  auto* closest_ex = node_pick(b, base, cn, ex);
+  const auto* closest_ex = node_pick(b, base, leaf, ex);
   ec.pred.multiclass = (closest_ex != nullptr) ? closest_ex->label : 0;
   ec.loss = (ec.l.multi.label != ec.pred.multiclass) ? ec.weight : 0;
 }
@@ -784,24 +927,37 @@ void node_predict(emt_tree& b, learner& base, emt_node& cn, emt_example& ex, VW:
 void emt_predict(emt_tree& b, learner& base, VW::example& ec)
 {
   b.all->feature_tweaks_config.ignore_some_linear = false;
-  emt_example ex(*b.all, &ec);
+  b.scratch.fill(*b.all, &ec, b.flat_scratch);
 
-  emt_node& cn = *tree_route(b, ex);
-  node_predict(b, base, cn, ex, ec);
-  tree_bound(b, &ex);
+  // the query is not stored in the tree so it has no slot to refresh in the bounder
+  node_predict(b, base, tree_route(b, b.scratch), b.scratch, ec);
 }
 
 void emt_learn(emt_tree& b, learner& base, VW::example& ec)
 {
   b.all->feature_tweaks_config.ignore_some_linear = false;
-  auto ex = VW::make_unique<emt_example>(*b.all, &ec);
 
-  emt_node& cn = *tree_route(b, *ex);
-  scorer_learn(b, base, cn, *ex, ec.weight);
-  node_predict(b, base, cn, *ex, ec);  // vw learners predict and emt_learn
-  tree_bound(b, ex.get());
-  node_insert(cn, std::move(ex));
-  node_split(b, cn);
+  // the slot is filled in place so a recycled slot reuses the feature storage of the memory it last held
+  emt_index slot = example_alloc(b);
+  emt_example& ex = b.examples[slot];
+  ex.fill(*b.all, &ec, b.flat_scratch);
+
+  emt_index leaf = tree_route(b, ex);
+  scorer_learn(b, base, leaf, ex, ec.weight);
+  node_predict(b, base, leaf, ex, ec);  // vw learners predict and emt_learn
+
+  emt_index duplicate = node_find_duplicate(b, leaf, slot);
+  if (duplicate != EMT_NULL_INDEX)
+  {
+    // an identical memory is already stored, so it is refreshed instead of storing a second copy
+    example_release(b, slot);
+    tree_bound(b, duplicate);
+    return;
+  }
+
+  node_insert(b, leaf, slot);
+  tree_bound(b, slot);
+  node_split(b, b.example_leaf[slot]);
 }
 
 #ifdef VW_ENABLE_EMT_DEBUG_TIMER
@@ -843,28 +999,81 @@ size_t write_model_field(
   return bytes;
 }
 
-size_t read_model_field(io_buf& io, reductions::eigen_memory_tree::emt_node& node)
+namespace
 {
+// Nodes and memories are written depth first with the same layout that std::unique_ptr children and a vector of
+// std::unique_ptr memories produce, so models are compatible across the switch to slab storage.
+size_t read_emt_node(
+    io_buf& io, reductions::eigen_memory_tree::emt_tree& tree, reductions::eigen_memory_tree::emt_index i)
+{
+  using namespace reductions::eigen_memory_tree;
   size_t bytes = 0;
-  bytes += read_model_field(io, node.router_decision);
-  bytes += read_model_field(io, node.left);
-  bytes += read_model_field(io, node.right);
-  bytes += read_model_field(io, node.router_weights);
-  bytes += read_model_field(io, node.examples);
+  bytes += read_model_field(io, tree.nodes[i].router_decision);
+
+  for (int child = 0; child < 2; child++)
+  {
+    bool is_null{};
+    bytes += read_model_field(io, is_null);
+    if (is_null) { continue; }
+
+    auto c = static_cast<emt_index>(tree.nodes.size());
+    tree.nodes.emplace_back();
+    if (child == 0) { tree.nodes[i].left = c; }
+    else { tree.nodes[i].right = c; }
+    bytes += read_emt_node(io, tree, c);
+  }
+
+  bytes += read_model_field(io, tree.nodes[i].router_weights);
+
+  uint32_t num_examples{};
+  bytes += read_model_field(io, num_examples);
+  tree.nodes[i].examples.reserve(num_examples);
+  for (uint32_t j = 0; j < num_examples; j++)
+  {
+    bool is_null{};
+    bytes += read_model_field(io, is_null);
+    if (is_null) { continue; }
+
+    auto slot = static_cast<emt_index>(tree.examples.size());
+    tree.examples.emplace_back();
+    tree.example_leaf.push_back(i);
+    bytes += read_model_field(io, tree.examples[slot]);
+    tree.nodes[i].examples.push_back(slot);
+  }
   return bytes;
 }
 
-size_t write_model_field(
-    io_buf& io, const reductions::eigen_memory_tree::emt_node& node, const std::string& upstream_name, bool text)
+size_t write_emt_node(io_buf& io, const reductions::eigen_memory_tree::emt_tree& tree,
+    reductions::eigen_memory_tree::emt_index i, const std::string& upstream_name, bool text)
 {
+  using namespace reductions::eigen_memory_tree;
+  const emt_node& node = tree.nodes[i];
   size_t bytes = 0;
   bytes += write_model_field(io, node.router_decision, upstream_name + ".router_decision", text);
-  bytes += write_model_field(io, node.left, upstream_name + ".left", text);
-  bytes += write_model_field(io, node.right, upstream_name + ".right", text);
+
+  const std::pair<emt_index, const char*> children[] = {{node.left, ".left"}, {node.right, ".right"}};
+  for (const auto& child : children)
+  {
+    const std::string name = upstream_name + child.second;
+    bool is_null = child.first == EMT_NULL_INDEX;
+    bytes += write_model_field(io, is_null, fmt::format("{}.is_null()", name), text);
+    if (!is_null) { bytes += write_emt_node(io, tree, child.first, name, text); }
+  }
+
   bytes += write_model_field(io, node.router_weights, upstream_name + ".router_weights", text);
-  bytes += write_model_field(io, node.examples, upstream_name + ".examples", text);
+
+  const std::string examples_name = upstream_name + ".examples";
+  auto num_examples = static_cast<uint32_t>(node.examples.size());
+  bytes += write_model_field(io, num_examples, examples_name + ".size()", text);
+  for (uint32_t j = 0; j < num_examples; j++)
+  {
+    const std::string name = fmt::format("{}[{}]", examples_name, j);
+    bytes += write_model_field(io, false, fmt::format("{}.is_null()", name), text);
+    bytes += write_model_field(io, tree.examples[node.examples[j]], name, text);
+  }
   return bytes;
 }
+}  // namespace
 
 size_t read_model_field(io_buf& io, reductions::eigen_memory_tree::emt_tree& tree)
 {
@@ -884,7 +1093,15 @@ size_t read_model_field(io_buf& io, reductions::eigen_memory_tree::emt_tree& tre
   bytes += read_model_field(io, tree_bound);
   tree.bounder = VW::make_unique<reductions::eigen_memory_tree::emt_lru>(tree_bound);
 
-  bytes += read_model_field(io, tree.root);
+  tree.nodes.clear();
+  tree.examples.clear();
+  tree.example_leaf.clear();
+  tree.free_examples.clear();
+
+  bool root_is_null{};
+  bytes += read_model_field(io, root_is_null);
+  tree.nodes.emplace_back();
+  if (!root_is_null) { bytes += read_emt_node(io, tree, 0); }
 
   return bytes;
 }
@@ -897,7 +1114,8 @@ size_t write_model_field(
   bytes += write_model_field(io, static_cast<uint32_t>(tree.scorer_type), upstream_name + ".scorer_type", text);
   bytes += write_model_field(io, static_cast<uint32_t>(tree.router_type), upstream_name + ".router_type", text);
   bytes += write_model_field(io, tree.bounder->max_size, upstream_name + ".tree_bound", text);
-  bytes += write_model_field(io, tree.root, upstream_name + ".root", text);
+  bytes += write_model_field(io, false, upstream_name + ".root.is_null()", text);
+  bytes += write_emt_node(io, tree, 0, upstream_name + ".root", text);
   return bytes;
 }
 
@@ -927,6 +1145,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::eigen_memory_tree_setup(VW
   std::string initial_type;
   uint32_t tree_bound = 0;
   uint32_t leaf_split = 0;
+  uint32_t scan_threads = 0;
 
   option_group_definition new_options("[Reduction] Eigen Memory Tree");
   new_options.add(make_option("emt", enabled).keep().necessary().help("Make an eigen memory tree"))
@@ -952,7 +1171,10 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::eigen_memory_tree_setup(VW
                .keep()
                .one_of({"random", "eigen"})
                .default_value("eigen")
-               .help("Indicates the type of router to use"));
+               .help("Indicates the type of router to use"))
+      .add(make_option("emt_threads", scan_threads)
+               .default_value(0)
+               .help("Number of threads used to prepare the candidates of large leaves for scoring"));
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
 
@@ -967,6 +1189,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::eigen_memory_tree_setup(VW
   auto t = VW::make_unique<VW::reductions::eigen_memory_tree::emt_tree>(&all, all.get_random_state(), leaf_split,
       emt_scorer_type_from_string(scorer_type), emt_router_type_from_string(router_type),
       emt_initial_type_from_string(initial_type), tree_bound);
+  t->scan_pool = VW::make_unique<VW::thread_pool>(scan_threads);
 
   auto l =
       make_reduction_learner(std::move(t), require_singleline(stack_builder.setup_base_learner()), emt_learn,
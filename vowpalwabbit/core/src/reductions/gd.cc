@@ -27,6 +27,10 @@
 #  elif defined(__SSE2__)
 #    include <xmmintrin.h>
 #  endif
+
+#  if defined(__AVX2__)
+#    include <immintrin.h>
+#  endif
 #endif
 
 #include "vw/core/accumulate.h"
@@ -126,10 +130,20 @@ void sync_weights(VW::workspace& all)
   }
   else
   {
-    for (VW::weight& w : all.weights.dense_weights)
-    {
-      w = VW::trunc_weight(w, static_cast<float>(all.sd->gravity)) * static_cast<float>(all.sd->contraction);
-    }
+    auto& weights = all.weights.dense_weights;
+    VW::weight* data = weights.data();
+    const uint32_t stride_shift = weights.stride_shift();
+    const auto gravity = static_cast<float>(all.sd->gravity);
+    const auto contraction = static_cast<float>(all.sd->contraction);
+    weights.parallel_for_ranges(
+        [data, stride_shift, gravity, contraction](uint64_t begin, uint64_t end)
+        {
+          for (uint64_t i = begin; i < end; i++)
+          {
+            VW::weight& w = data[i << stride_shift];
+            w = VW::trunc_weight(w, gravity) * contraction;
+          }
+        });
   }
 
   all.sd->gravity = 0.;
@@ -499,20 +513,164 @@ inline void vec_add_trunc_multipredict(VW::details::multipredict_info<T>& mp, co
   }
 }
 
+// Dense multipredict accumulates the scores of all classes into a contiguous buffer, so the per-feature loop over
+// classes can run four classes per SSE instruction, or eight per AVX instruction when the build enables AVX2 (as
+// cmake/VWFlags.cmake does on Linux x86_64). The weights of consecutive classes are step floats apart.
+class dense_multipredict_info
+{
+public:
+  size_t count;
+  size_t step;
+  float* scores;
+  const VW::dense_parameters& weights;
+};
+
+#if !defined(VW_NO_INLINE_SIMD) && defined(__SSE2__) && !defined(__ARM_NEON__)
+#  define VW_GD_SSE_MULTIPREDICT
+
+// Loads w[0], w[STEP], w[2 * STEP] and w[3 * STEP]. May read anything below w[4 * STEP].
+template <size_t STEP>
+inline __m128 load_strided(const float* w)
+{
+  return _mm_setr_ps(w[0], w[STEP], w[2 * STEP], w[3 * STEP]);
+}
+
+template <>
+inline __m128 load_strided<1>(const float* w)
+{
+  return _mm_loadu_ps(w);
+}
+
+template <>
+inline __m128 load_strided<2>(const float* w)
+{
+  return _mm_shuffle_ps(_mm_loadu_ps(w), _mm_loadu_ps(w + 4), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+template <>
+inline __m128 load_strided<4>(const float* w)
+{
+  const __m128 lo = _mm_unpacklo_ps(_mm_loadu_ps(w), _mm_loadu_ps(w + 4));
+  const __m128 hi = _mm_unpacklo_ps(_mm_loadu_ps(w + 8), _mm_loadu_ps(w + 12));
+  return _mm_movelh_ps(lo, hi);
+}
+
+#  if defined(__AVX2__)
+#    define VW_GD_AVX2_MULTIPREDICT
+
+// Loads w[0], w[STEP], ..., w[7 * STEP]. May read anything below w[8 * STEP].
+template <size_t STEP>
+inline __m256 load_strided8(const float* w)
+{
+  return _mm256_set_m128(load_strided<STEP>(w + 4 * STEP), load_strided<STEP>(w));
+}
+
+template <>
+inline __m256 load_strided8<1>(const float* w)
+{
+  return _mm256_loadu_ps(w);
+}
+#  endif
+#endif
+
+// scores[c] += fx * w[c * STEP] for every class. The caller guarantees w[count * STEP - 1] is in bounds.
+template <size_t STEP>
+inline void accumulate_class_scores(float* scores, const float* w, size_t count, size_t /* step */, float fx)
+{
+  size_t c = 0;
+#ifdef VW_GD_AVX2_MULTIPREDICT
+  // Multiply and add stay separate instructions so the scores match the scalar path bit for bit.
+  const __m256 x8 = _mm256_set1_ps(fx);
+  for (; c + 8 <= count; c += 8, w += 8 * STEP)
+  {
+    _mm256_storeu_ps(
+        scores + c, _mm256_add_ps(_mm256_loadu_ps(scores + c), _mm256_mul_ps(x8, load_strided8<STEP>(w))));
+  }
+#endif
+#ifdef VW_GD_SSE_MULTIPREDICT
+  const __m128 x = _mm_set1_ps(fx);
+  for (; c + 4 <= count; c += 4, w += 4 * STEP)
+  {
+    _mm_storeu_ps(scores + c, _mm_add_ps(_mm_loadu_ps(scores + c), _mm_mul_ps(x, load_strided<STEP>(w))));
+  }
+#endif
+  for (; c < count; c++, w += STEP) { scores[c] += fx * *w; }
+}
+
+template <>
+inline void accumulate_class_scores<0>(float* scores, const float* w, size_t count, size_t step, float fx)
+{
+  for (size_t c = 0; c < count; c++, w += step) { scores[c] += fx * *w; }
+}
+
+// STEP is the class step when it is one of the common strides, 0 when it is only known at runtime.
+template <size_t STEP>
+inline void vec_add_dense_multipredict(dense_multipredict_info& mp, const float fx, uint64_t fi)
+{
+  if ((-1e-10 < fx) && (fx < 1e-10)) { return; }
+  const uint64_t mask = mp.weights.mask();
+  const size_t step = STEP == 0 ? mp.step : STEP;
+  fi &= mask;
+  if (fi + mp.count * step <= mask + 1)
+  {
+    accumulate_class_scores<STEP>(mp.scores, &mp.weights[fi], mp.count, step, fx);
+  }
+  else
+  {
+    // The classes wrap around the end of the weight table.
+    for (size_t c = 0; c < mp.count; c++, fi += step) { mp.scores[c] += fx * mp.weights[fi]; }
+  }
+}
+
+size_t dense_multipredict(VW::reductions::gd& g, VW::example& ec, size_t count, size_t step, float initial)
+{
+  VW::workspace& all = *g.all;
+  g.multipredict_scores.assign(count, initial);
+  dense_multipredict_info mp = {count, step, g.multipredict_scores.data(), all.weights.dense_weights};
+
+  size_t num_features_from_interactions = 0;
+  switch (step)
+  {
+    case 1:
+      VW::foreach_feature<dense_multipredict_info, uint64_t, vec_add_dense_multipredict<1>>(
+          all, ec, mp, num_features_from_interactions);
+      break;
+    case 2:
+      VW::foreach_feature<dense_multipredict_info, uint64_t, vec_add_dense_multipredict<2>>(
+          all, ec, mp, num_features_from_interactions);
+      break;
+    case 4:
+      VW::foreach_feature<dense_multipredict_info, uint64_t, vec_add_dense_multipredict<4>>(
+          all, ec, mp, num_features_from_interactions);
+      break;
+    case 8:
+      VW::foreach_feature<dense_multipredict_info, uint64_t, vec_add_dense_multipredict<8>>(
+          all, ec, mp, num_features_from_interactions);
+      break;
+    default:
+      VW::foreach_feature<dense_multipredict_info, uint64_t, vec_add_dense_multipredict<0>>(
+          all, ec, mp, num_features_from_interactions);
+      break;
+  }
+  return num_features_from_interactions;
+}
+
 template <bool l1, bool audit>
 void multipredict(VW::reductions::gd& g, VW::example& ec, size_t count, size_t step, VW::polyprediction* pred,
     bool finalize_predictions)
 {
   VW::workspace& all = *g.all;
-  for (size_t c = 0; c < count; c++)
-  {
-    const auto& simple_red_features = ec.ex_reduction_features.template get<VW::simple_label_reduction_features>();
-    pred[c].scalar = simple_red_features.initial;
-  }
+  const auto& simple_red_features = ec.ex_reduction_features.template get<VW::simple_label_reduction_features>();
 
   size_t num_features_from_interactions = 0;
-  if (g.all->weights.sparse)
+  if (!l1 && !g.all->weights.sparse)
   {
+    num_features_from_interactions = dense_multipredict(g, ec, count, step, simple_red_features.initial);
+    for (size_t c = 0; c < count; c++) { pred[c].scalar = g.multipredict_scores[c]; }
+  }
+  else if (g.all->weights.sparse)
+  {
+    for (size_t c = 0; c < count; c++) { pred[c].scalar = simple_red_features.initial; }
     VW::details::multipredict_info<VW::sparse_parameters> mp = {
         count, step, pred, g.all->weights.sparse_weights, static_cast<float>(all.sd->gravity)};
     if (l1)
@@ -528,18 +686,11 @@ void multipredict(VW::reductions::gd& g, VW::example& ec, size_t count, size_t s
   }
   else
   {
+    for (size_t c = 0; c < count; c++) { pred[c].scalar = simple_red_features.initial; }
     VW::details::multipredict_info<VW::dense_parameters> mp = {
         count, step, pred, g.all->weights.dense_weights, static_cast<float>(all.sd->gravity)};
-    if (l1)
-    {
-      VW::foreach_feature<VW::details::multipredict_info<VW::dense_parameters>, uint64_t, vec_add_trunc_multipredict>(
-          all, ec, mp, num_features_from_interactions);
-    }
-    else
-    {
-      VW::foreach_feature<VW::details::multipredict_info<VW::dense_parameters>, uint64_t,
-          VW::details::vec_add_multipredict>(all, ec, mp, num_features_from_interactions);
-    }
+    VW::foreach_feature<VW::details::multipredict_info<VW::dense_parameters>, uint64_t, vec_add_trunc_multipredict>(
+        all, ec, mp, num_features_from_interactions);
   }
   ec.num_features_from_interactions = num_features_from_interactions;
 
@@ -933,6 +1084,7 @@ void save_load_regressor(VW::workspace& all, VW::io_buf& model_file, bool read,
 
 void VW::details::save_load_regressor_gd(VW::workspace& all, VW::io_buf& model_file, bool read, bool text)
 {
+  if (!read && model_file.skips_weights()) { return; }
   if (all.weights.sparse) { ::save_load_regressor(all, model_file, read, text, all.weights.sparse_weights); }
   else { ::save_load_regressor(all, model_file, read, text, all.weights.dense_weights); }
 }
@@ -1232,6 +1384,7 @@ void VW::details::save_load_online_state_gd(VW::workspace& all, VW::io_buf& mode
     all.sd->total_features = 0;
     all.passes_config.current_pass = 0;
   }
+  if (!read && model_file.skips_weights()) { return; }
   if (all.weights.sparse)
   {
     save_load_online_state_weights(all, model_file, read, text, g, msg, ftrl_size, all.weights.sparse_weights);
@@ -1258,7 +1411,7 @@ void save_load(VW::reductions::gd& g, VW::io_buf& model_file, bool read, bool te
         weights[1] = init_t;
       };
 
-      all.weights.set_default(initial_gd_weight_initializer);
+      all.weights.set_default_by_index(initial_gd_weight_initializer);
 
       // for adaptive update, we interpret initial_t as previously seeing initial_t fake datapoints, all with squared
       // gradient=1 NOTE: this is not invariant to the scaling of the data (i.e. when combined with normalized). Since
@@ -1293,7 +1446,7 @@ void save_load(VW::reductions::gd& g, VW::io_buf& model_file, bool read, bool te
       VW::details::save_load_regressor_gd(all, model_file, read, text);
     }
   }
-  if (!all.runtime_config.training)
+  if (!all.runtime_config.training && !model_file.skips_weights())
   {  // If the regressor was saved without --predict_only_model, then when testing we want to
      // materialize the weights.
     sync_weights(all);
@@ -269,7 +269,7 @@ void save_load(gdmf& d, VW::io_buf& model_file, bool read, bool text)
       auto weight_initializer = [stride](VW::weight* weights, uint64_t index)
       { initialize_weights(weights, index, stride); };
 
-      all.weights.set_default(weight_initializer);
+      all.weights.set_default_by_index(weight_initializer);
     }
   }
 
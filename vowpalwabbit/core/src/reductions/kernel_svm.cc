@@ -13,25 +13,30 @@
 #include "vw/core/learner.h"
 #include "vw/core/loss_functions.h"
 #include "vw/core/memory.h"
+#include "vw/core/metric_sink.h"
 #include "vw/core/model_utils.h"
 #include "vw/core/numeric_casts.h"
 #include "vw/core/reductions/gd.h"
 #include "vw/core/setup_base.h"
+#include "vw/core/thread_pool.h"
 #include "vw/core/version.h"
 #include "vw/core/vw.h"
 #include "vw/core/vw_allreduce.h"
 #include "vw/core/vw_versions.h"
 #include "vw/io/logger.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cfloat>
 #include <cmath>
 #include <cstdio>
 #include <cstring>
 #include <fstream>
+#include <future>
 #include <map>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 #define SVM_KER_LIN 0
 #define SVM_KER_RBF 1
@@ -115,14 +120,12 @@ size_t write_model_field_flat_example(VW::io_buf& io, const flat_example& fe, co
 
 class svm_params;
 
-static size_t num_kernel_evals = 0;
-static size_t num_cache_evals = 0;
-
 class svm_example
 {
 public:
   VW::v_array<float> krow;
   flat_example ex;
+  uint64_t last_access = 0;  // kernel cache clock value of the last use of krow
 
   ~svm_example();
   void init_svm_example(flat_example* fec);
@@ -176,8 +179,25 @@ public:
   uint64_t reprocess = 0;
 
   svm_model* model = nullptr;
-  size_t maxcache = 0;
-  // size_t curcache;
+  size_t maxcache = 0;  // kernel cache budget in number of cached kernel values
+
+  // kernel cache statistics
+  uint64_t cache_clock = 0;
+  uint64_t cache_hits = 0;
+  uint64_t cache_misses = 0;
+  uint64_t cache_evictions = 0;
+  // legacy counters reported at the end of the run
+  size_t num_kernel_evals = 0;
+  size_t num_cache_evals = 0;
+
+  // The example whose kernel row is being computed is scattered into a dense buffer indexed by feature index, which
+  // turns each sparse dot product against a support vector into a scalar gather loop without the merge branches. All
+  // entries are zero between uses. Left empty if the index space is too large.
+  std::vector<float> dense_query;
+  bool dense_query_checked = false;
+  // Rows are split into blocks of support vectors evaluated on the pool. A pool without threads runs them inline.
+  std::unique_ptr<VW::thread_pool> kernel_pool;
+  std::vector<std::future<void>> kernel_futures;
 
   svm_example** pool = nullptr;
   float lambda = 0.f;
@@ -216,29 +236,31 @@ svm_example::~svm_example()
   // free_flatten_example(fec);  // free contents of flat example and frees fec.
 }
 
-float kernel_function(const flat_example* fec1, const flat_example* fec2, void* params, size_t kernel_type);
+void compute_kernel_row(svm_params& params, const flat_example& query, size_t begin, size_t end, float* out);
 
 int svm_example::compute_kernels(svm_params& params)
 {
   int alloc = 0;
   svm_model* model = params.model;
   size_t n = model->num_support;
+  last_access = ++params.cache_clock;
 
-  if (krow.size() < n)
+  const size_t cached = krow.size();
+  if (cached < n)
   {
     // computing new kernel values and caching them
-    // if(params->curcache + n > params->maxcache)
-    // trim_cache(params);
-    num_kernel_evals += krow.size();
-    for (size_t i = krow.size(); i < n; i++)
-    {
-      svm_example* sec = model->support_vec[i];
-      float kv = kernel_function(&ex, &(sec->ex), params.kernel_params, params.kernel_type);
-      krow.push_back(kv);
-      alloc += 1;
-    }
+    params.num_kernel_evals += cached;
+    params.cache_hits += cached;
+    params.cache_misses += n - cached;
+    krow.resize(n);
+    compute_kernel_row(params, ex, cached, n, krow.begin() + cached);
+    alloc += static_cast<int>(n - cached);
+  }
+  else
+  {
+    params.num_cache_evals += n;
+    params.cache_hits += n;
   }
-  else { num_cache_evals += n; }
   return alloc;
 }
 
@@ -246,6 +268,7 @@ int svm_example::clear_kernels()
 {
   int rowsize = static_cast<int>(krow.size());
   krow.clear();
+  krow.shrink_to_fit();
   return -rowsize;
 }
 
@@ -291,17 +314,31 @@ static int make_hot_sv(svm_params& params, size_t svi)
   return alloc;
 }
 
+// Drops least recently used kernel rows until the cache fits in maxcache.
 static int trim_cache(svm_params& params)
 {
-  int sz = static_cast<int>(params.maxcache);
   svm_model* model = params.model;
-  size_t n = model->num_support;
-  int alloc = 0;
-  for (size_t i = 0; i < n; i++)
+  size_t cached = 0;
+  std::vector<svm_example*> rows;
+  for (size_t i = 0; i < model->num_support; i++)
   {
     svm_example* e = model->support_vec[i];
-    sz -= static_cast<int>(e->krow.size());
-    if (sz < 0) { alloc += e->clear_kernels(); }
+    if (e->krow.empty()) { continue; }
+    cached += e->krow.size();
+    rows.push_back(e);
+  }
+  if (cached <= params.maxcache) { return 0; }
+
+  std::sort(rows.begin(), rows.end(),
+      [](const svm_example* a, const svm_example* b) { return a->last_access < b->last_access; });
+
+  int alloc = 0;
+  for (svm_example* e : rows)
+  {
+    if (cached <= params.maxcache) { break; }
+    cached -= e->krow.size();
+    alloc += e->clear_kernels();
+    params.cache_evictions++;
   }
   return alloc;
 }
@@ -385,6 +422,99 @@ float kernel_function(const flat_example* fec1, const flat_example* fec2, void*
   return 0;
 }
 
+// Same as kernel_function for a dot product that has already been computed.
+float kernel_from_dot(
+    float dotprod, const flat_example* fec1, const flat_example* fec2, void* params, size_t kernel_type)
+{
+  switch (kernel_type)
+  {
+    case SVM_KER_RBF:
+      return expf(-(fec1->total_sum_feat_sq + fec2->total_sum_feat_sq - 2 * dotprod) * *(static_cast<float*>(params)));
+    case SVM_KER_POLY:
+      return static_cast<float>(std::pow(1 + dotprod, *(static_cast<int*>(params))));
+    case SVM_KER_LIN:
+      return dotprod;
+  }
+  return 0;
+}
+
+// One scalar load from the dense query per support vector feature. Products are accumulated in index order, matching
+// features_dot_product exactly.
+float gather_dot(const std::vector<float>& dense, const VW::features& fs)
+{
+  const uint64_t* indices = fs.indices.data();
+  const float* values = fs.values.data();
+  float dotprod = 0.f;
+  for (size_t i = 0; i < fs.size(); i++) { dotprod += dense[indices[i]] * values[i]; }
+  return dotprod;
+}
+
+// Largest index space the dense query buffer is allowed to cover (64MB).
+constexpr size_t MAX_DENSE_QUERY_SIZE = static_cast<size_t>(1) << 24;
+// Minimum number of kernel evaluations per task submitted to the kernel pool.
+constexpr size_t KERNEL_BLOCK_SIZE = 256;
+// Largest max_pos * num_support for which a reprocessed support vector is moved to the front. This was the fixed
+// kernel cache size before --kernel_cache_mb, and is kept separate from it so the budget does not change what is
+// learned.
+constexpr size_t MAX_HOT_SV_ROTATION = static_cast<size_t>(1) << 30;
+
+void compute_kernel_block(const svm_params& params, const flat_example& query, bool use_dense, size_t begin,
+    size_t end, float* out)
+{
+  const svm_model* model = params.model;
+  for (size_t i = begin; i < end; i++)
+  {
+    const flat_example& sv = model->support_vec[i]->ex;
+    if (use_dense && (sv.fs.empty() || sv.fs.indices.back() < params.dense_query.size()))
+    {
+      *out++ = kernel_from_dot(
+          gather_dot(params.dense_query, sv.fs), &query, &sv, params.kernel_params, params.kernel_type);
+    }
+    else { *out++ = kernel_function(&query, &sv, params.kernel_params, params.kernel_type); }
+  }
+}
+
+void compute_kernel_row(svm_params& params, const flat_example& query, size_t begin, size_t end, float* out)
+{
+  if (!params.dense_query_checked && params.all->weights.not_null())
+  {
+    const size_t index_space = (params.all->weights.mask() >> params.all->weights.stride_shift()) + 1;
+    if (index_space <= MAX_DENSE_QUERY_SIZE) { params.dense_query.resize(index_space, 0.f); }
+    params.dense_query_checked = true;
+  }
+
+  const auto& indices = query.fs.indices;
+  const bool use_dense = !params.dense_query.empty() && (indices.empty() || indices.back() < params.dense_query.size());
+  if (use_dense)
+  {
+    for (size_t i = 0; i < query.fs.size(); i++) { params.dense_query[indices[i]] = query.fs.values[i]; }
+  }
+
+  const size_t count = end - begin;
+  const size_t num_threads = params.kernel_pool == nullptr ? 0 : params.kernel_pool->size();
+  if (num_threads == 0 || count < 2 * KERNEL_BLOCK_SIZE)
+  {
+    compute_kernel_block(params, query, use_dense, begin, end, out);
+  }
+  else
+  {
+    const size_t block_size = std::max(KERNEL_BLOCK_SIZE, (count + num_threads - 1) / num_threads);
+    for (size_t block_begin = begin; block_begin < end; block_begin += block_size)
+    {
+      const size_t block_end = std::min(end, block_begin + block_size);
+      params.kernel_futures.emplace_back(params.kernel_pool->submit(compute_kernel_block, std::cref(params),
+          std::cref(query), use_dense, block_begin, block_end, out + (block_begin - begin)));
+    }
+    for (auto& future : params.kernel_futures) { future.get(); }
+    params.kernel_futures.clear();
+  }
+
+  if (use_dense)
+  {
+    for (size_t i = 0; i < query.fs.size(); i++) { params.dense_query[indices[i]] = 0.f; }
+  }
+}
+
 float dense_dot(float* v1, const VW::v_array<float>& v2, size_t n)
 {
   float dot_prod = 0.;
@@ -690,7 +820,7 @@ void train(svm_params& params)
               {
                 *params.all->output_runtime.trace_message << "Shouldn't reprocess right after process." << endl;
               }
-              if (max_pos * model->num_support <= params.maxcache) { make_hot_sv(params, max_pos); }
+              if (max_pos * model->num_support <= MAX_HOT_SV_ROTATION) { make_hot_sv(params, max_pos); }
               update(params, max_pos);
             }
           }
@@ -730,8 +860,8 @@ void learn(svm_params& params, VW::example& ec)
     if (params.all->runtime_config.training && ec.example_counter % 1000 == 0 && ec.example_counter >= 2)
     {
       *params.all->output_runtime.trace_message << "Number of support vectors = " << params.model->num_support << endl;
-      *params.all->output_runtime.trace_message << "Number of kernel evaluations = " << num_kernel_evals << " "
-                                                << "Number of cache queries = " << num_cache_evals
+      *params.all->output_runtime.trace_message << "Number of kernel evaluations = " << params.num_kernel_evals << " "
+                                                << "Number of cache queries = " << params.num_cache_evals
                                                 << " loss sum = " << params.loss_sum << " "
                                                 << params.model->alpha[params.model->num_support - 1] << " "
                                                 << params.model->alpha[params.model->num_support - 2] << endl;
@@ -752,11 +882,23 @@ void finish_kernel_svm(svm_params& params)
   if (params.all != nullptr)
   {
     *(params.all->output_runtime.trace_message) << "Num support = " << params.model->num_support << endl;
-    *(params.all->output_runtime.trace_message) << "Number of kernel evaluations = " << num_kernel_evals << " "
-                                                << "Number of cache queries = " << num_cache_evals << endl;
+    *(params.all->output_runtime.trace_message) << "Number of kernel evaluations = " << params.num_kernel_evals << " "
+                                                << "Number of cache queries = " << params.num_cache_evals << endl;
     *(params.all->output_runtime.trace_message) << "Total loss = " << params.loss_sum << endl;
   }
 }
+
+void persist_metrics(svm_params& params, VW::metric_sink& metrics)
+{
+  size_t cached = 0;
+  for (size_t i = 0; i < params.model->num_support; i++) { cached += params.model->support_vec[i]->krow.size(); }
+
+  metrics.set_uint("ksvm_num_support", params.model->num_support);
+  metrics.set_uint("ksvm_kernel_cache_hits", params.cache_hits);
+  metrics.set_uint("ksvm_kernel_cache_misses", params.cache_misses);
+  metrics.set_uint("ksvm_kernel_cache_evictions", params.cache_evictions);
+  metrics.set_uint("ksvm_kernel_cache_bytes", cached * sizeof(float));
+}
 }  // namespace
 
 std::shared_ptr<VW::LEARNER::learner> VW::reductions::kernel_svm_setup(VW::setup_base_i& stack_builder)
@@ -771,6 +913,8 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::kernel_svm_setup(VW::setup
   uint64_t pool_size;
   uint64_t reprocess;
   uint64_t subsample;
+  uint64_t kernel_cache_mb;
+  uint64_t kernel_threads;
 
   bool ksvm = false;
 
@@ -787,7 +931,13 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::kernel_svm_setup(VW::setup
                .one_of({"linear", "rbf", "poly"})
                .help("Type of kernel"))
       .add(make_option("bandwidth", bandwidth).keep().default_value(1.f).help("Bandwidth of rbf kernel"))
-      .add(make_option("degree", degree).keep().default_value(2).help("Degree of poly kernel"));
+      .add(make_option("degree", degree).keep().default_value(2).help("Degree of poly kernel"))
+      .add(make_option("kernel_cache_mb", kernel_cache_mb)
+               .default_value(4096)
+               .help("Maximum size in MB of cached kernel rows. Least recently used rows are evicted first"))
+      .add(make_option("kernel_threads", kernel_threads)
+               .default_value(0)
+               .help("Number of threads used to evaluate kernel rows against the support vectors in blocks"));
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
 
@@ -802,7 +952,8 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::kernel_svm_setup(VW::setup
   params->model = &VW::details::calloc_or_throw<svm_model>();
   new (params->model) svm_model();
   params->model->num_support = 0;
-  params->maxcache = 1024 * 1024 * 1024;
+  params->maxcache = VW::cast_to_smaller_type<size_t>(kernel_cache_mb * 1024 * 1024 / sizeof(float));
+  params->kernel_pool = VW::make_unique<VW::thread_pool>(VW::cast_to_smaller_type<size_t>(kernel_threads));
   params->loss_sum = 0.;
   params->all = &all;
   params->random_state = all.get_random_state();
@@ -848,6 +999,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::kernel_svm_setup(VW::setup
       VW::prediction_type_t::SCALAR, VW::label_type_t::SIMPLE)
                .set_save_load(save_load)
                .set_finish(finish_kernel_svm)
+               .set_persist_metrics(persist_metrics)
                .set_output_example_prediction(VW::details::output_example_prediction_simple_label<svm_params>)
                .set_update_stats(VW::details::update_stats_simple_label<svm_params>)
                .set_print_update(VW::details::print_update_simple_label<svm_params>)
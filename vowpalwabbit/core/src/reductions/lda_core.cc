@@ -787,7 +787,7 @@ void save_load(lda& l, VW::io_buf& model_file, bool read, bool text)
       weights[lda] = init.initial;
     };
 
-    all.weights.set_default(initial_lda_weight_initializer);
+    all.weights.set_default_by_index(initial_lda_weight_initializer);
   }
   if (model_file.num_files() != 0)
   {
@@ -14,6 +14,7 @@
 #include "vw/core/multilabel.h"
 #include "vw/core/numeric_casts.h"
 #include "vw/core/setup_base.h"
+#include "vw/core/thread_pool.h"
 #include "vw/core/v_array.h"
 #include "vw/core/vw.h"
 #include "vw/io/logger.h"
@@ -23,8 +24,10 @@
 #include <cmath>
 #include <cstdio>
 #include <ctime>
+#include <future>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 using namespace VW::LEARNER;
 using namespace VW::config;
@@ -206,6 +209,15 @@ public:
 
   VW::example* kprod_ec = nullptr;
 
+  // Flattened features of the memories, filled the first time a memory is scanned and reused by every later scan
+  std::vector<VW::features> flat_examples;
+  std::vector<bool> flat_examples_cached;
+  VW::features flat_query;
+  std::vector<float> leaf_scores;
+  // Similarities for large leaves are computed in blocks on this pool. A pool without threads runs them inline.
+  std::unique_ptr<VW::thread_pool> scan_pool;
+  std::vector<std::future<void>> scan_futures;
+
   memory_tree()
   {
     alpha = 0.5f;
@@ -227,15 +239,33 @@ public:
   }
 };
 
+float normalized_linear_prod(const VW::features& fs1, const VW::features& fs2)
+{
+  float norm_sqrt = std::pow(fs1.sum_feat_sq * fs2.sum_feat_sq, 0.5f);
+  float linear_prod = VW::features_dot_product(fs1, fs2);
+  return linear_prod / norm_sqrt;
+}
+
 float normalized_linear_prod(memory_tree& b, VW::example* ec1, VW::example* ec2)
 {
   VW::features fs1;
   VW::features fs2;
   flatten_features(*b.all, *ec1, fs1);
   flatten_features(*b.all, *ec2, fs2);
-  float norm_sqrt = std::pow(fs1.sum_feat_sq * fs2.sum_feat_sq, 0.5f);
-  float linear_prod = VW::features_dot_product(fs1, fs2);
-  return linear_prod / norm_sqrt;
+  return normalized_linear_prod(fs1, fs2);
+}
+
+void cache_flat_example(memory_tree& b, uint32_t loc)
+{
+  if (b.flat_examples.size() < b.examples.size())
+  {
+    b.flat_examples.resize(b.examples.size());
+    b.flat_examples_cached.resize(b.examples.size(), false);
+  }
+  if (b.flat_examples_cached[loc]) { return; }
+
+  flatten_features(*b.all, *b.examples[loc], b.flat_examples[loc]);
+  b.flat_examples_cached[loc] = true;
 }
 
 void init_tree(memory_tree& b)
@@ -577,42 +607,72 @@ inline uint32_t compute_hamming_loss_via_oas(
   return hamming_loss(ec.l.multilabels.label_v, selected_labs);
 }
 
+// Minimum number of memories per task submitted to the scan pool.
+constexpr size_t LEAF_SCAN_BLOCK_SIZE = 64;
+
+void leaf_similarity_block(const memory_tree& b, const uint32_t* locs, size_t begin, size_t end, float* out)
+{
+  for (size_t i = begin; i < end; i++) { out[i] = normalized_linear_prod(b.flat_query, b.flat_examples[locs[i]]); }
+}
+
 // pick up the "closest" example in the leaf using the score function.
+// The query is flattened once per scan and the memories once per tree, after which the similarities of the whole
+// leaf are computed in a single pass, split over the scan pool when the leaf is large.
 int64_t pick_nearest(memory_tree& b, learner& base, const uint64_t cn, VW::example& ec)
 {
-  if (b.nodes[cn].examples_index.size() > 0)
+  const auto& locs = b.nodes[cn].examples_index;
+  if (locs.empty()) { return -1; }
+
+  const size_t count = locs.size();
+  flatten_features(*b.all, ec, b.flat_query);
+  for (auto loc : locs) { cache_flat_example(b, loc); }
+  b.leaf_scores.resize(count);
+
+  const size_t num_threads = b.scan_pool == nullptr ? 0 : b.scan_pool->size();
+  if (num_threads == 0 || count < 2 * LEAF_SCAN_BLOCK_SIZE)
+  {
+    leaf_similarity_block(b, locs.data(), 0, count, b.leaf_scores.data());
+  }
+  else
   {
-    float max_score = -FLT_MAX;
-    int64_t max_pos = -1;
-    for (size_t i = 0; i < b.nodes[cn].examples_index.size(); i++)
+    const size_t block_size = std::max(LEAF_SCAN_BLOCK_SIZE, (count + num_threads - 1) / num_threads);
+    for (size_t block_begin = 0; block_begin < count; block_begin += block_size)
     {
-      float score = 0.f;
-      uint32_t loc = b.nodes[cn].examples_index[i];
+      const size_t block_end = std::min(count, block_begin + block_size);
+      b.scan_futures.emplace_back(b.scan_pool->submit(
+          leaf_similarity_block, std::cref(b), locs.data(), block_begin, block_end, b.leaf_scores.data()));
+    }
+    for (auto& future : b.scan_futures) { future.get(); }
+    b.scan_futures.clear();
+  }
 
-      // do not use reward to update memory tree during the very first pass
-      //(which is for unsupervised training for memory tree)
-      if (b.learn_at_leaf == true && b.current_pass >= 1)
-      {
-        float tmp_s = normalized_linear_prod(b, &ec, b.examples[loc]);
-        diag_kronecker_product_test(ec, *b.examples[loc], *b.kprod_ec, b.oas);
-        b.kprod_ec->l.simple = {FLT_MAX};
-        auto& simple_red_features =
-            b.kprod_ec->ex_reduction_features.template get<VW::simple_label_reduction_features>();
-        simple_red_features.initial = tmp_s;
-        base.predict(*b.kprod_ec, b.max_routers);
-        score = b.kprod_ec->partial_prediction;
-      }
-      else { score = normalized_linear_prod(b, &ec, b.examples[loc]); }
+  // do not use reward to update memory tree during the very first pass
+  //(which is for unsupervised training for memory tree)
+  if (b.learn_at_leaf == true && b.current_pass >= 1)
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      diag_kronecker_product_test(ec, *b.examples[locs[i]], *b.kprod_ec, b.oas);
+      b.kprod_ec->l.simple = {FLT_MAX};
+      auto& simple_red_features =
+          b.kprod_ec->ex_reduction_features.template get<VW::simple_label_reduction_features>();
+      simple_red_features.initial = b.leaf_scores[i];
+      base.predict(*b.kprod_ec, b.max_routers);
+      b.leaf_scores[i] = b.kprod_ec->partial_prediction;
+    }
+  }
 
-      if (score > max_score)
-      {
-        max_score = score;
-        max_pos = static_cast<int64_t>(loc);
-      }
+  float max_score = -FLT_MAX;
+  int64_t max_pos = -1;
+  for (size_t i = 0; i < count; i++)
+  {
+    if (b.leaf_scores[i] > max_score)
+    {
+      max_score = b.leaf_scores[i];
+      max_pos = static_cast<int64_t>(locs[i]);
     }
-    return max_pos;
   }
-  else { return -1; }
+  return max_pos;
 }
 
 // for any two examples, use number of overlap labels to indicate the similarity between these two examples.
@@ -1171,6 +1231,8 @@ void save_load_memory_tree(memory_tree& b, VW::io_buf& model_file, bool read, bo
     if (read)
     {
       b.examples.clear();
+      b.flat_examples.clear();
+      b.flat_examples_cached.clear();
       for (uint32_t i = 0; i < n_examples; i++)
       {
         VW::example* new_ec = new VW::example;
@@ -1198,6 +1260,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::memory_tree_setup(VW::setu
   uint64_t max_nodes;
   uint64_t max_num_labels;
   uint64_t leaf_example_multiplier;
+  uint64_t scan_threads;
   option_group_definition new_options("[Reduction] Memory Tree");
 
   new_options
@@ -1220,13 +1283,17 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::memory_tree_setup(VW::setu
       .add(make_option("dream_at_update", tree->dream_at_update)
                .default_value(0)
                .help("Turn on dream operations at reward based update as well"))
-      .add(make_option("online", tree->online).help("Turn on dream operations at reward based update as well"));
+      .add(make_option("online", tree->online).help("Turn on dream operations at reward based update as well"))
+      .add(make_option("leaf_scan_threads", scan_threads)
+               .default_value(0)
+               .help("Number of threads used to score the memories of large leaves"));
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
   tree->max_nodes = VW::cast_to_smaller_type<size_t>(max_nodes);
   tree->max_num_labels = VW::cast_to_smaller_type<size_t>(max_num_labels);
   tree->leaf_example_multiplier = VW::cast_to_smaller_type<size_t>(leaf_example_multiplier);
   tree->all = &all;
+  tree->scan_pool = VW::make_unique<VW::thread_pool>(VW::cast_to_smaller_type<size_t>(scan_threads));
   tree->random_state = all.get_random_state();
   tree->current_pass = 0;
   tree->final_pass = all.runtime_config.numpasses;
@@ -59,6 +59,10 @@ public:
   uint32_t top_k = 0;
   std::vector<VW::polyprediction> node_pred;  // for storing results of base.multipredict
   std::vector<node> node_queue;               // container for queue used for both types of predictions
+  std::vector<node> frontier;                 // internal nodes expanded together during threshold prediction
+  std::vector<node> next_frontier;
+  std::vector<float> child_probs;        // sigmoid of the children's scores, kary per expanded node
+  std::vector<uint32_t> expanded_nodes;  // expanded nodes in increasing order, matching child_probs
   bool probabilities = false;
 
   // for measuring predictive performance
@@ -172,6 +176,32 @@ inline float evaluate_node(uint32_t n, learner& base, VW::example& ec)
   return ec.loss;
 }
 
+// Appends the sigmoid scores of the children of the given internal nodes, sorted by node number, to p.child_probs.
+// The children of consecutive nodes are consecutive, so each run of consecutive nodes is scored by one feature walk.
+void score_children(plt& p, learner& base, VW::example& ec, const std::vector<node>& nodes)
+{
+  ec.l.simple = {FLT_MAX};
+  ec.ex_reduction_features.template get<VW::simple_label_reduction_features>().reset_to_default();
+
+  size_t first = 0;
+  while (first < nodes.size())
+  {
+    size_t last = first + 1;
+    while (last < nodes.size() && nodes[last].n == nodes[last - 1].n + 1) { ++last; }
+
+    const size_t count = static_cast<size_t>(nodes[last - 1].n - nodes[first].n + 1) * p.kary;
+    if (p.node_pred.size() < count) { p.node_pred.resize(count); }
+    base.multipredict(ec, p.kary * nodes[first].n + 1, count, p.node_pred.data(), false);
+
+    for (size_t i = first; i < last; ++i)
+    {
+      const auto* preds = p.node_pred.data() + static_cast<size_t>(nodes[i].n - nodes[first].n) * p.kary;
+      for (uint32_t c = 0; c < p.kary; ++c) { p.child_probs.push_back(sigmoid(preds[c].scalar)); }
+    }
+    first = last;
+  }
+}
+
 template <bool threshold>
 void predict(plt& p, learner& base, VW::example& ec)
 {
@@ -213,7 +243,35 @@ void predict(plt& p, learner& base, VW::example& ec)
   // prediction with threshold
   if (threshold)
   {
+    // Every node above the threshold gets expanded, so the tree is first expanded level by level, scoring each
+    // level's frontier in as few feature walks as possible. The depth-first search then runs over the stored scores,
+    // which keeps the order of the predicted labels.
+    p.frontier.clear();
+    p.child_probs.clear();
+    p.expanded_nodes.clear();
     float cp_root = predict_node(0, base, ec);
+    if (cp_root > p.threshold) { p.frontier.push_back({0, cp_root}); }
+
+    while (!p.frontier.empty())
+    {
+      const size_t first_prob = p.child_probs.size();
+      score_children(p, base, ec, p.frontier);
+
+      p.next_frontier.clear();
+      for (size_t i = 0; i < p.frontier.size(); ++i)
+      {
+        const auto& parent = p.frontier[i];
+        p.expanded_nodes.push_back(parent.n);
+        uint32_t n_child = p.kary * parent.n + 1;
+        for (uint32_t c = 0; c < p.kary; ++c, ++n_child)
+        {
+          float cp_child = parent.p * p.child_probs[first_prob + i * p.kary + c];
+          if (cp_child > p.threshold && n_child < p.ti) { p.next_frontier.push_back({n_child, cp_child}); }
+        }
+      }
+      std::swap(p.frontier, p.next_frontier);
+    }
+
     if (cp_root > p.threshold)
     {
       p.node_queue.push_back({0, cp_root});  // here queue is used for dfs search
@@ -224,14 +282,12 @@ void predict(plt& p, learner& base, VW::example& ec)
       node node = p.node_queue.back();  // current node
       p.node_queue.pop_back();
 
+      const auto expanded = std::lower_bound(p.expanded_nodes.begin(), p.expanded_nodes.end(), node.n);
+      const float* probs = p.child_probs.data() + (expanded - p.expanded_nodes.begin()) * p.kary;
       uint32_t n_child = p.kary * node.n + 1;
-      ec.l.simple = {FLT_MAX};
-      ec.ex_reduction_features.template get<VW::simple_label_reduction_features>().reset_to_default();
-      base.multipredict(ec, n_child, p.kary, p.node_pred.data(), false);
-
       for (uint32_t i = 0; i < p.kary; ++i, ++n_child)
       {
-        float cp_child = node.p * sigmoid(p.node_pred[i].scalar);
+        float cp_child = node.p * probs[i];
         if (cp_child > p.threshold)
         {
           if (n_child < p.ti) { p.node_queue.push_back({n_child, cp_child}); }
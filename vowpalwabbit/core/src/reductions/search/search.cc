@@ -9,6 +9,7 @@
 #include "vw/core/crossplat_compat.h"
 #include "vw/core/label_dictionary.h"
 #include "vw/core/learner.h"
+#include "vw/core/metric_sink.h"
 #include "vw/core/named_labels.h"
 #include "vw/core/numeric_casts.h"
 #include "vw/core/parse_primitives.h"
@@ -34,6 +35,7 @@
 #include <cmath>
 #include <cstring>
 #include <memory>
+#include <unordered_map>
 // needed for printing ranges of objects (eg: all elements of a vector)
 #include <fmt/ranges.h>
 
@@ -44,8 +46,6 @@ using std::endl;
 
 namespace Search
 {
-using byte_array = std::unique_ptr<uint8_t[]>;
-
 std::array<search_task*, 10> all_tasks = {&SequenceTask::task, &SequenceSpanTask::task, &SequenceTaskCostToGo::task,
     &ArgmaxTask::task, &SequenceTask_DemoLDF::task, &MulticlassTask::task, &DepParserTask::task,
     &EntityRelationTask::task, &HookTask::task, &GraphTask::task};
@@ -148,33 +148,98 @@ std::ostream& operator<<(std::ostream& os, const action_cache& x)
 
 void clear_memo_foreach_action(search_private& priv);
 
-class search_private
+// Cache of predictions made during rollouts. Entries are found by a 64 bit hash of the conditioning state and hold
+// the full state, which is compared on every hit, so two states that share a hash never share a prediction. Entries
+// are kept in two generations: once the current generation holds half of the capacity it replaces the previous
+// generation, whose entries are evicted. A hit in the previous generation moves the entry to the current one, so the
+// cache approximates LRU while holding at most capacity entries (rounded up to an even number).
+class prediction_cache
 {
-private:
-  class cached_item_equivalent
+public:
+  size_t capacity = 0;  // 0 means unbounded
+
+  size_t hits = 0;
+  size_t misses = 0;
+  size_t evictions = 0;
+
+  bool find(uint64_t hash, const std::vector<uint64_t>& key, scored_action& out)
   {
-  public:
-    bool operator()(const byte_array& lhs, const byte_array& rhs) const
+    auto it = _current.find(hash);
+    if (it != _current.end() && it->second.key == key)
     {
-      size_t sz_lhs = *lhs.get();
-      size_t sz_rhs = *rhs.get();
-      if (sz_lhs != sz_rhs) { return false; }
-      return memcmp(lhs.get(), rhs.get(), sz_lhs) == 0;
+      out = it->second.sa;
+      hits++;
+      return true;
     }
-  };
-  class cached_item_hash
+
+    it = _previous.find(hash);
+    if (it == _previous.end() || it->second.key != key)
+    {
+      misses++;
+      return false;
+    }
+    entry promoted = std::move(it->second);
+    _previous.erase(it);
+    out = promoted.sa;
+    insert(hash, std::move(promoted));
+    hits++;
+    return true;
+  }
+
+  void store(uint64_t hash, const std::vector<uint64_t>& key, const scored_action& sa)
+  {
+    entry e;
+    e.key = key;
+    e.sa = sa;
+    insert(hash, std::move(e));
+  }
+
+  void clear()
+  {
+    _current.clear();
+    _previous.clear();
+  }
+
+  size_t size() const { return _current.size() + _previous.size(); }
+
+  size_t bytes() const
+  {
+    // unordered_map nodes hold the value and a next pointer, and the bucket array holds one pointer per bucket
+    constexpr size_t node_bytes = sizeof(std::pair<const uint64_t, entry>) + sizeof(void*);
+    size_t key_bytes = 0;
+    for (const auto& kv : _current) { key_bytes += kv.second.key.capacity() * sizeof(uint64_t); }
+    for (const auto& kv : _previous) { key_bytes += kv.second.key.capacity() * sizeof(uint64_t); }
+    return size() * node_bytes + key_bytes + (_current.bucket_count() + _previous.bucket_count()) * sizeof(void*);
+  }
+
+private:
+  class entry
   {
   public:
-    size_t operator()(const byte_array& key) const
+    std::vector<uint64_t> key;
+    scored_action sa;
+  };
+
+  void insert(uint64_t hash, entry&& e)
+  {
+    if (capacity != 0 && _current.size() >= (capacity + 1) / 2)
     {
-      size_t sz = *key.get();
-      return VW::uniform_hash(reinterpret_cast<const char*>(key.get()), sz, static_cast<uint32_t>(SEARCH_HASH_SEED));
+      evictions += _previous.size();
+      // swap then clear keeps the bucket arrays of both generations allocated
+      std::swap(_current, _previous);
+      _current.clear();
     }
-  };
+    // a colliding state replaces the entry under its hash
+    _current[hash] = std::move(e);
+  }
 
-public:
-  using cache_map = std::unordered_map<byte_array, scored_action, cached_item_hash, cached_item_equivalent>;
+  std::unordered_map<uint64_t, entry> _current;
+  std::unordered_map<uint64_t, entry> _previous;
+};
 
+class search_private
+{
+public:
   VW::workspace* all = nullptr;
   std::shared_ptr<VW::rand_state> random_state;
 
@@ -275,7 +340,9 @@ public:
   size_t total_predictions_made = 0;
   size_t total_cache_hits = 0;
 
-  cache_map cache_hash_map;
+  // predictions of the current policy, cleared whenever it learns
+  prediction_cache cache;
+  std::vector<uint64_t> cache_key;  // scratch buffer for the key of a cache lookup
 
   // for foreach_feature temporary storage for conditioning
   uint64_t dat_new_feature_idx = 0;
@@ -1411,18 +1478,27 @@ int choose_policy(search_private& priv, bool advance_prng = true)
   }
 }
 
-bool cached_item_equivalent(unsigned char* const& A, unsigned char* const& B)
+inline uint64_t cache_key_combine(uint64_t seed, uint64_t value)
 {
-  size_t sz_A = *A;  // NOLINT
-  size_t sz_B = *B;  // NOLINT
-  if (sz_A != sz_B) { return false; }
-  return memcmp(A, B, sz_A) == 0;
+  // 64 bit variant of boost::hash_combine
+  return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+inline uint64_t cache_key_finalize(uint64_t h)
+{
+  // MurmurHash3 fmix64
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
 }
 
 // returns true if found and do_store is false. if do_store is true, always returns true.
 bool cached_action_store_or_find(search_private& priv, ptag mytag, const ptag* condition_on,
     const char* condition_on_names, action_repr* condition_on_actions, size_t condition_on_cnt, int policy,
-    size_t learner_id, action& a, bool do_store, float& a_cost)
+    int learner, action& a, bool do_store, float& a_cost)
 {
   if (priv.no_caching) { return do_store; }
   if (mytag == 0)
@@ -1430,47 +1506,36 @@ bool cached_action_store_or_find(search_private& priv, ptag mytag, const ptag* c
     return do_store;  // don't attempt to cache when tag is zero
   }
 
-  size_t sz = sizeof(size_t) + sizeof(ptag) + sizeof(int) + sizeof(size_t) + sizeof(size_t) +
-      condition_on_cnt * (sizeof(ptag) + sizeof(action) + sizeof(char));
-  if (sz % 4 != 0)
-  {
-    sz += 4 - (sz % 4);  // make sure sz aligns to 4 so that uniform_hash does the right thing
-  }
-
-  byte_array item(new uint8_t[sz]);
-  uint8_t* here = item.get();
-  // get rid of a valgrind warning about uninitialized memory
-  memset(here, 0, sz);
-  *here = static_cast<unsigned char>(sz);
-  here += sizeof(size_t);
-  *here = static_cast<uint8_t>(mytag);
-  here += sizeof(ptag);
-  *here = static_cast<uint8_t>(policy);
-  here += sizeof(int);
-  *here = static_cast<unsigned char>(learner_id);
-  here += sizeof(size_t);
-  *here = static_cast<unsigned char>(condition_on_cnt);
-  here += sizeof(size_t);
+  // the full conditioning state, built in a reused buffer so a lookup does not allocate
+  auto& key = priv.cache_key;
+  key.clear();
+  key.push_back(mytag);
+  key.push_back(static_cast<uint64_t>(static_cast<int64_t>(policy)));
+  // the learner select_learner resolved to, which under --search_xv also depends on the example
+  key.push_back(static_cast<uint64_t>(static_cast<int64_t>(learner)));
+  key.push_back(condition_on_cnt);
   for (size_t i = 0; i < condition_on_cnt; i++)
   {
-    *here = static_cast<uint8_t>(condition_on[i]);
-    here += sizeof(ptag);
-    *here = static_cast<uint8_t>(condition_on_actions[i].a);
-    here += sizeof(action);
-    *here = condition_on_names[i];
-    here += sizeof(char);  // SPEEDUP: should we align this at 4?
+    key.push_back(condition_on[i]);
+    key.push_back(condition_on_actions[i].a);
+    key.push_back(static_cast<unsigned char>(condition_on_names[i]));
   }
+
+  uint64_t hash = SEARCH_HASH_SEED;
+  for (uint64_t value : key) { hash = cache_key_combine(hash, value); }
+  hash = cache_key_finalize(hash);
+
   if (do_store)
   {
-    priv.cache_hash_map.emplace(std::move(item), scored_action(a, a_cost));
+    priv.cache.store(hash, key, scored_action(a, a_cost));
     return true;
   }
   else  // its a find
   {
-    auto sa_iter = priv.cache_hash_map.find(item);
-    if (sa_iter == priv.cache_hash_map.end()) { return false; }
-    a = sa_iter->second.a;
-    a_cost = sa_iter->second.s;
+    scored_action sa;
+    if (!priv.cache.find(hash, key, sa)) { return false; }
+    a = sa.a;
+    a_cost = sa.s;
     return a != static_cast<action>(-1);
   }
 }
@@ -1594,6 +1659,9 @@ void generate_training_example(search_private& priv, VW::polylabel& losses, floa
       }
     }
   }
+
+  // the policy has changed, so predictions cached before this update are stale
+  priv.cache.clear();
 }
 
 bool search_predict_needs_example(search_private& priv)
@@ -1851,7 +1919,7 @@ action search_predict(search_private& priv, VW::example* ecs, size_t ec_cnt, pta
 
       if ((!skip) && (!need_fea) && not_test &&
           cached_action_store_or_find(priv, mytag, condition_on, condition_on_names, priv.condition_on_actions.data(),
-              condition_on_cnt, policy, learner_id, a, false, a_cost))
+              condition_on_cnt, policy, learner, a, false, a_cost))
       {
         // if this succeeded, 'a' has the right action
         priv.total_cache_hits++;
@@ -1934,7 +2002,7 @@ action search_predict(search_private& priv, VW::example* ecs, size_t ec_cnt, pta
         if (not_test && (!skip))
         {
           cached_action_store_or_find(priv, mytag, condition_on, condition_on_names, priv.condition_on_actions.data(),
-              condition_on_cnt, policy, learner_id, a, true, a_cost);
+              condition_on_cnt, policy, learner, a, true, a_cost);
         }
       }
     }
@@ -2165,8 +2233,7 @@ void train_single_example(search& sch, bool is_test_ex, bool is_holdout_ex, VW::
   VW::workspace& all = *priv.all;
   bool ran_test = false;  // we must keep track so that even if we skip test, we still update # of examples seen
 
-  // if (! priv.no_caching)
-  priv.cache_hash_map.clear();
+  priv.cache.clear();
 
   cdbg << "is_test_ex=" << is_test_ex << " vw_is_main=" << all.runtime_config.vw_is_main << endl;
   cdbg << "must_run_test = " << must_run_test(all, ec_seq, is_test_ex) << endl;
@@ -2212,7 +2279,7 @@ void train_single_example(search& sch, bool is_test_ex, bool is_holdout_ex, VW::
   cdbg << "======================================== INIT TRAIN (" << priv.current_policy << ","
        << priv.read_example_last_pass << ") ========================================" << endl;
 
-  priv.cache_hash_map.clear();
+  priv.cache.clear();
   reset_search_structure(priv);
   clear_memo_foreach_action(priv);
   priv.state = search_state::INIT_TRAIN;
@@ -2427,6 +2494,8 @@ void end_pass(search& sch)
   VW::workspace* all = priv.all;
   priv.hit_new_pass = true;
   priv.read_example_last_pass++;
+  // cached predictions were made by the policy of the previous pass
+  priv.cache.clear();
   priv.passes_since_new_policy++;
 
   if (priv.passes_since_new_policy >= priv.passes_per_policy)
@@ -2544,6 +2613,16 @@ void handle_condition_options(VW::workspace& all, auto_condition_settings& acset
   acset.max_quad_ngram_length = VW::cast_to_smaller_type<size_t>(max_quad_ngram_length);
 }
 
+void persist_metrics(search& sch, VW::metric_sink& metrics)
+{
+  const prediction_cache& cache = sch.priv->cache;
+  metrics.set_uint("search_cache_hits", cache.hits);
+  metrics.set_uint("search_cache_misses", cache.misses);
+  metrics.set_uint("search_cache_evictions", cache.evictions);
+  metrics.set_uint("search_cache_entries", cache.size());
+  metrics.set_uint("search_cache_bytes", cache.bytes());
+}
+
 void search_finish(search& sch)
 {
   search_private& priv = *sch.priv;
@@ -3106,6 +3185,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::search_setup(VW::setup_bas
   uint64_t history_length;
   uint64_t rollout_num_steps;
   uint64_t save_every_k_runs;
+  uint64_t search_cache_size;
 
   uint32_t search_trained_nb_policies;
   std::string search_allowed_transitions;
@@ -3169,6 +3249,9 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::search_setup(VW::setup_bas
                .help("Some tasks allow you to specify how much history their depend on; specify that here"))
       .add(make_option("search_no_caching", priv.no_caching)
                .help("Turn off the built-in caching ability (makes things slower, but technically more safe)"))
+      .add(make_option("search_cache_size", search_cache_size)
+               .default_value(1 << 20)
+               .help("Maximum number of rollout predictions kept in the cache (0 means unbounded)"))
       .add(make_option("search_xv", priv.xv).help("Train two separate policies, alternating prediction/learning"))
       .add(make_option("search_perturb_oracle", priv.perturb_oracle)
                .default_value(0.f)
@@ -3187,6 +3270,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::search_setup(VW::setup_bas
   priv.rollout_num_steps = VW::cast_to_smaller_type<size_t>(rollout_num_steps);
   priv.history_length = VW::cast_to_smaller_type<size_t>(history_length);
   priv.save_every_k_runs = VW::cast_to_smaller_type<size_t>(save_every_k_runs);
+  priv.cache.capacity = VW::cast_to_smaller_type<size_t>(search_cache_size);
 
   search_initialize(&all, *sch.get());
 
@@ -3392,6 +3476,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::search_setup(VW::setup_bas
           .set_end_examples(end_examples)
           .set_finish(search_finish)
           .set_end_pass(end_pass)
+          .set_persist_metrics(persist_metrics)
           .set_input_label_type(expected_label_type)
           // .set_output_label(priv.cb_learner ? label_type_t::CB : label_type_t::CS)
           // .set_input_prediction(priv.active_csoaa ? ec.pred.active_multiclass.predicted_class : ec.pred.multiclass)
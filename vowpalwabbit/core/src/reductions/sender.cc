@@ -5,6 +5,7 @@
 #include "vw/core/reductions/sender.h"
 
 #include "vw/cache_parser/parse_example_cache.h"
+#include "vw/common/hash.h"
 #include "vw/config/options.h"
 #include "vw/core/daemon_utils.h"
 #include "vw/core/global_data.h"
@@ -12,12 +13,19 @@
 #include "vw/core/learner.h"
 #include "vw/core/loss_functions.h"
 #include "vw/core/network.h"
+#include "vw/core/numeric_casts.h"
 #include "vw/core/parser.h"
 #include "vw/core/setup_base.h"
 #include "vw/core/simple_label.h"
 #include "vw/core/vw_fwd.h"
 #include "vw/io/errno_handling.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 using namespace VW::config;
@@ -42,25 +50,59 @@ struct sent_example_info
   }
 };
 
-class sender
+// A sent example waiting for its prediction. Results are reported on the learner thread in the order the examples
+// were sent, so a prediction that arrives early from one endpoint waits here until the ones before it are in.
+class pending_result
+{
+public:
+  sent_example_info info;
+  float prediction = 0.f;
+  bool received = false;
+};
+
+// One --sendto daemon. The learner thread writes examples to output and flushes it every batch. The receiver thread
+// reads the predictions, which a daemon sends back in the order it got the examples, so that waiting on the socket
+// never blocks the learner thread.
+class endpoint
 {
 public:
-  VW::io_buf socket_output_buffer;
   std::unique_ptr<VW::io::socket> socket;
   std::unique_ptr<VW::io::reader> socket_reader;
-  VW::workspace* all = nullptr;  // loss example_queue_limit others
-  std::vector<sent_example_info> delay_ring;
-  size_t sent_index = 0;
-  size_t received_index = 0;
-  VW::parsers::cache::details::cache_temp_buffer cache_buffer;
+  VW::io_buf output;
+  size_t unflushed = 0;
+  // Sequence numbers of the examples sent to this endpoint and not answered yet, oldest first.
+  std::deque<size_t> in_flight;
+  std::thread receiver;
 };
 
-void open_sockets(sender& s, const std::string& host)
+enum class sharding_type
 {
-  s.socket = VW::details::open_vw_binary_socket(host, s.all->logger);
-  s.socket_reader = s.socket->get_reader();
-  s.socket_output_buffer.add_file(s.socket->get_writer());
-}
+  ROUND_ROBIN,
+  HASH
+};
+
+class sender
+{
+public:
+  ~sender();
+
+  VW::workspace* all = nullptr;  // loss example_queue_limit others
+  std::vector<std::unique_ptr<endpoint>> endpoints;
+  sharding_type sharding = sharding_type::ROUND_ROBIN;
+  size_t window = 0;
+  size_t batch_size = 0;
+  size_t next_endpoint = 0;
+  VW::parsers::cache::details::cache_temp_buffer cache_buffer;
+
+  // Guards everything below and the endpoints' in_flight queues.
+  std::mutex lock;
+  std::condition_variable progress;
+  std::deque<pending_result> pending;
+  size_t sent_index = 0;
+  size_t reported_index = 0;
+  bool done = false;
+  std::exception_ptr receive_error;
+};
 
 void update_stats_sender(VW::shared_data& sd, const sent_example_info& info, float loss)
 {
@@ -91,14 +133,8 @@ void print_update_sender(VW::workspace& all, VW::shared_data& sd, const sent_exa
   }
 }
 
-void receive_result(sender& s)
+void report_result(sender& s, const sent_example_info& sent_info, float prediction)
 {
-  float prediction{};
-  float weight{};
-
-  VW::details::get_prediction(s.socket_reader.get(), prediction, weight);
-  const auto& sent_info = s.delay_ring[s.received_index++ % s.all->parser_runtime.example_parser->example_queue_limit];
-
   const auto& ld = sent_info.label;
   const auto loss = s.all->loss_config.loss->get_loss(s.all->sd.get(), prediction, ld.label) * sent_info.weight;
 
@@ -107,26 +143,165 @@ void receive_result(sender& s)
   print_update_sender(*s.all, *(s.all->sd), sent_info, prediction);
 }
 
+void receive_results(sender& s, endpoint& e)
+{
+  try
+  {
+    while (true)
+    {
+      {
+        std::unique_lock<std::mutex> lock(s.lock);
+        s.progress.wait(lock, [&s, &e] { return !e.in_flight.empty() || s.done; });
+        if (e.in_flight.empty()) { return; }
+      }
+
+      float prediction{};
+      float weight{};
+      VW::details::get_prediction(e.socket_reader.get(), prediction, weight);
+
+      std::lock_guard<std::mutex> lock(s.lock);
+      const size_t sequence = e.in_flight.front();
+      e.in_flight.pop_front();
+      auto& result = s.pending[sequence - s.reported_index];
+      result.prediction = prediction;
+      result.received = true;
+      s.progress.notify_all();
+    }
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> lock(s.lock);
+    if (s.receive_error == nullptr) { s.receive_error = std::current_exception(); }
+    s.progress.notify_all();
+  }
+}
+
+void flush_endpoint(endpoint& e)
+{
+  if (e.unflushed == 0) { return; }
+  e.output.flush();
+  e.unflushed = 0;
+}
+
+void flush_all(sender& s)
+{
+  for (auto& e : s.endpoints) { flush_endpoint(*e); }
+}
+
+sender::~sender()
+{
+  // Normally end_examples has already stopped the receivers. When learning stopped early, everything written is sent
+  // so that the daemons answer it and the receivers can finish.
+  try
+  {
+    flush_all(*this);
+  }
+  catch (...)
+  {
+  }
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    done = true;
+  }
+  progress.notify_all();
+  for (auto& e : endpoints)
+  {
+    if (e->receiver.joinable()) { e->receiver.join(); }
+  }
+}
+
+void open_sockets(sender& s, const std::vector<std::string>& hosts)
+{
+  for (const auto& host : hosts)
+  {
+    auto e = VW::make_unique<endpoint>();
+    e->socket = VW::details::open_vw_binary_socket(host, s.all->logger);
+    e->socket_reader = e->socket->get_reader();
+    e->output.add_file(e->socket->get_writer());
+    s.endpoints.push_back(std::move(e));
+  }
+  for (auto& e : s.endpoints) { e->receiver = std::thread(receive_results, std::ref(s), std::ref(*e)); }
+}
+
+endpoint& select_endpoint(sender& s, const VW::example& ec)
+{
+  if (s.sharding == sharding_type::HASH && !ec.tag.empty())
+  {
+    const auto hash = VW::uniform_hash(ec.tag.begin(), ec.tag.size(), 0);
+    return *s.endpoints[hash % s.endpoints.size()];
+  }
+  auto& e = *s.endpoints[s.next_endpoint];
+  s.next_endpoint = (s.next_endpoint + 1) % s.endpoints.size();
+  return e;
+}
+
+// Waits on the learner thread until the condition holds. Buffered examples are sent first, since the predictions
+// being waited for may be behind them.
+template <typename condition_type>
+void wait_for(sender& s, std::unique_lock<std::mutex>& lock, condition_type condition)
+{
+  if (s.receive_error == nullptr && !condition())
+  {
+    lock.unlock();
+    flush_all(s);
+    lock.lock();
+    s.progress.wait(lock, [&s, &condition] { return s.receive_error != nullptr || condition(); });
+  }
+  if (s.receive_error) { std::rethrow_exception(s.receive_error); }
+}
+
+// Reports the oldest sent example, waiting for its prediction if needed.
+void report_next_result(sender& s)
+{
+  pending_result result;
+  {
+    std::unique_lock<std::mutex> lock(s.lock);
+    wait_for(s, lock, [&s] { return s.pending.front().received; });
+    result = std::move(s.pending.front());
+    s.pending.pop_front();
+    s.reported_index++;
+  }
+  report_result(s, result.info, result.prediction);
+}
+
 void send_example(sender& s, VW::example& ec)
 {
-  if (s.received_index + s.all->parser_runtime.example_parser->example_queue_limit / 2 - 1 == s.sent_index)
+  // Results are reported once window examples per endpoint are outstanding. With one endpoint this is the point at
+  // which the sender has always reported them, so the output does not depend on when predictions arrive.
+  while (s.sent_index - s.reported_index >= s.window * s.endpoints.size()) { report_next_result(s); }
+
+  auto& e = select_endpoint(s, ec);
   {
-    receive_result(s);
+    std::unique_lock<std::mutex> lock(s.lock);
+    wait_for(s, lock, [&s, &e] { return e.in_flight.size() < s.window; });
   }
 
   if (s.all->set_minmax) { s.all->set_minmax(ec.l.simple.label); }
-  VW::parsers::cache::write_example_to_cache(s.socket_output_buffer, &ec,
-      s.all->parser_runtime.example_parser->lbl_parser, s.all->runtime_state.parse_mask, s.cache_buffer);
-  s.socket_output_buffer.flush();
-  s.delay_ring[s.sent_index++ % s.all->parser_runtime.example_parser->example_queue_limit] =
-      sent_example_info{ec.l.simple, ec.weight, ec.test_only, ec.get_num_features(), ec.tag};
+  VW::parsers::cache::write_example_to_cache(
+      e.output, &ec, s.all->parser_runtime.example_parser->lbl_parser, s.all->runtime_state.parse_mask, s.cache_buffer);
+  {
+    std::lock_guard<std::mutex> lock(s.lock);
+    s.pending.emplace_back();
+    s.pending.back().info = sent_example_info{ec.l.simple, ec.weight, ec.test_only, ec.get_num_features(), ec.tag};
+    e.in_flight.push_back(s.sent_index++);
+  }
+  s.progress.notify_all();
+
+  if (++e.unflushed >= s.batch_size) { flush_endpoint(e); }
 }
 
 void end_examples(sender& s)
 {
+  while (s.reported_index != s.sent_index) { report_next_result(s); }
+  {
+    std::lock_guard<std::mutex> lock(s.lock);
+    s.done = true;
+  }
+  s.progress.notify_all();
+  for (auto& e : s.endpoints) { e->receiver.join(); }
+
   // close our outputs to signal finishing.
-  while (s.received_index != s.sent_index) { receive_result(s); }
-  s.socket_output_buffer.close_files();
+  for (auto& e : s.endpoints) { e->output.close_files(); }
 }
 }  // namespace
 
@@ -136,20 +311,44 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::sender_setup(VW::setup_bas
 {
   VW::config::options_i& options = *stack_builder.get_options();
   VW::workspace& all = *stack_builder.get_all_pointer();
-  std::string host;
+  std::vector<std::string> hosts;
+  std::string sharding;
+  uint64_t window;
+  uint64_t batch_size;
 
   option_group_definition sender_options("[Reduction] Network sending");
-  sender_options.add(make_option("sendto", host)
-                         .keep()
-                         .necessary()
-                         .help("Send examples to <host>. Host can be of form hostname or hostname:port"));
+  sender_options
+      .add(make_option("sendto", hosts)
+               .keep()
+               .necessary()
+               .help("Send examples to <host>. Host can be of form hostname or hostname:port. Repeat to spread the "
+                     "examples over several daemons"))
+      .add(make_option("send_sharding", sharding)
+               .default_value("round_robin")
+               .one_of({"round_robin", "hash"})
+               .help("How examples are spread over the --sendto hosts. hash sends all examples with the same tag to "
+                     "the same host; untagged examples go round robin"))
+      .add(make_option("send_window", window)
+               .help("Maximum number of examples sent to one host whose predictions have not been received yet. "
+                     "Defaults to half the example queue limit"))
+      .add(make_option("send_batch", batch_size)
+               .default_value(64)
+               .help("Number of examples written to a host before they are flushed to its socket"));
 
   if (!options.add_parse_and_check_necessary(sender_options)) { return nullptr; }
+  if (!options.was_supplied("send_window"))
+  {
+    window = std::max<uint64_t>(all.parser_runtime.example_parser->example_queue_limit / 2, 2) - 1;
+  }
+  if (window == 0) { THROW("--send_window must be at least 1"); }
+  if (batch_size == 0) { THROW("--send_batch must be at least 1"); }
 
   auto s = VW::make_unique<sender>();
   s->all = &all;
-  s->delay_ring.resize(all.parser_runtime.example_parser->example_queue_limit);
-  open_sockets(*s, host);
+  s->sharding = sharding == "hash" ? sharding_type::HASH : sharding_type::ROUND_ROBIN;
+  s->window = VW::cast_to_smaller_type<size_t>(window);
+  s->batch_size = VW::cast_to_smaller_type<size_t>(batch_size);
+  open_sockets(*s, hosts);
 
   auto l = make_bottom_learner(std::move(s), send_example, send_example, stack_builder.get_setupfn_name(sender_setup),
       VW::prediction_type_t::SCALAR, VW::label_type_t::SIMPLE)
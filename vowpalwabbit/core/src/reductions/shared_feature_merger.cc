@@ -11,6 +11,7 @@
 #include "vw/core/learner.h"
 #include "vw/core/scope_exit.h"
 #include "vw/core/setup_base.h"
+#include "vw/core/shared_interaction_cache.h"
 #include "vw/core/vw.h"
 
 #include <iterator>
@@ -30,6 +31,7 @@ public:
   std::unique_ptr<sfm_metrics> metrics;
   VW::label_type_t label_type = VW::label_type_t::CB;
   bool store_shared_ex_in_reduction_features = false;
+  VW::details::shared_interaction_cache shared_interactions;
 };
 
 template <bool is_learn, bool is_cb_with_observations>
@@ -47,6 +49,10 @@ void predict_or_learn(sfm_data& data, VW::LEARNER::learner& base, VW::multi_ex&
     shared_example = ec_seq[0];
     ec_seq.erase(ec_seq.begin());
 
+    // Shared-only interactions expand the same for every action, so with more than one action they are expanded once.
+    const bool use_shared_interactions = ec_seq.size() > 1;
+    if (use_shared_interactions) { data.shared_interactions.reset(shared_example); }
+
     // merge sequences
     for (auto& example : ec_seq)
     {
@@ -56,6 +62,7 @@ void predict_or_learn(sfm_data& data, VW::LEARNER::learner& base, VW::multi_ex&
       }
 
       VW::details::append_example_namespaces_from_example(*example, *shared_example);
+      if (use_shared_interactions) { example->shared_interactions = &data.shared_interactions; }
     }
 
     std::swap(ec_seq[0]->pred, shared_example->pred);
@@ -71,7 +78,7 @@ void predict_or_learn(sfm_data& data, VW::LEARNER::learner& base, VW::multi_ex&
 
   // Guard example state restore against throws
   auto restore_guard = VW::scope_exit(
-      [has_example_header, &shared_example, &ec_seq, &store_shared_ex_in_reduction_features]
+      [has_example_header, &shared_example, &ec_seq, &store_shared_ex_in_reduction_features, &data]
       {
         if (has_example_header)
         {
@@ -83,7 +90,9 @@ void predict_or_learn(sfm_data& data, VW::LEARNER::learner& base, VW::multi_ex&
             }
 
             VW::details::truncate_example_namespaces_from_example(*example, *shared_example);
+            example->shared_interactions = nullptr;
           }
+          data.shared_interactions.reset(nullptr);
           std::swap(shared_example->pred, ec_seq[0]->pred);
           std::swap(shared_example->tag, ec_seq[0]->tag);
           std::swap(shared_example->ex_reduction_features, ec_seq[0]->ex_reduction_features);
@@ -0,0 +1,103 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/shared_interaction_cache.h"
+
+#include "vw/core/example.h"
+#include "vw/core/interactions_predict.h"
+
+namespace
+{
+bool is_shared_only(const std::vector<VW::namespace_index>& interaction, const VW::example& shared,
+    const std::array<VW::features, VW::NUM_NAMESPACES>& action_feature_space)
+{
+  for (auto ns : interaction)
+  {
+    // The merger does not copy the constant namespace, and an action with features of its own in a namespace has a
+    // larger group than the shared example.
+    if (ns == VW::details::CONSTANT_NAMESPACE) { return false; }
+    const auto& shared_group = shared.feature_space[ns];
+    const auto& action_group = action_feature_space[ns];
+    if (shared_group.empty() || action_group.size() != shared_group.size() ||
+        action_group.sum_feat_sq != shared_group.sum_feat_sq)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+void VW::details::shared_interaction_cache::reset(const VW::example* shared)
+{
+  _shared = shared;
+  for (size_t i = 0; i < _num_used; i++) { _entries[i].terms.clear(); }
+  _num_used = 0;
+  _total_terms = 0;
+}
+
+const std::vector<VW::details::shared_interaction_cache::term>* VW::details::shared_interaction_cache::find(
+    const std::vector<VW::namespace_index>& interaction, bool permutations,
+    const std::array<VW::features, VW::NUM_NAMESPACES>& action_feature_space)
+{
+  if (_shared == nullptr || !is_shared_only(interaction, *_shared, action_feature_space)) { return nullptr; }
+
+  for (size_t i = 0; i < _num_used; i++)
+  {
+    const auto& e = _entries[i];
+    if (e.permutations == permutations && e.interaction == interaction)
+    {
+      return e.cacheable ? &e.terms : nullptr;
+    }
+  }
+
+  if (_num_used == _entries.size()) { _entries.emplace_back(); }
+  auto& e = _entries[_num_used++];
+  e.interaction = interaction;
+  e.permutations = permutations;
+  e.terms.clear();
+
+  // Expand from the shared example with the same routines generate_interactions uses, recording instead of
+  // dispatching.
+  bool overflow = false;
+  const auto record_kernel = [&](VW::features::const_audit_iterator begin, VW::features::const_audit_iterator end,
+                                 VW::feature_value value, VW::feature_index halfhash)
+  {
+    for (; begin != end; ++begin)
+    {
+      if (_total_terms + e.terms.size() >= MAX_TERMS)
+      {
+        overflow = true;
+        return;
+      }
+      e.terms.push_back({begin.index() ^ halfhash, VW::details::interaction_value(value, begin.value())});
+    }
+  };
+  const auto no_audit = [](const VW::audit_strings*) {};
+
+  const auto& fs = _shared->feature_space;
+  if (interaction.size() == 2)
+  {
+    VW::details::process_quadratic_interaction<false>(
+        VW::details::generate_quadratic_char_combination(fs, interaction[0], interaction[1]), permutations,
+        record_kernel, no_audit);
+  }
+  else if (interaction.size() == 3)
+  {
+    VW::details::process_cubic_interaction<false>(
+        VW::details::generate_cubic_char_combination(fs, interaction[0], interaction[1], interaction[2]),
+        permutations, record_kernel, no_audit);
+  }
+  else
+  {
+    std::vector<VW::details::feature_gen_data> state_data;
+    VW::details::process_generic_interaction<false>(VW::details::generate_generic_char_combination(fs, interaction),
+        permutations, record_kernel, no_audit, state_data);
+  }
+
+  if (overflow) { e.terms.clear(); }
+  e.cacheable = !overflow;
+  _total_terms += e.terms.size();
+  return e.cacheable ? &e.terms : nullptr;
+}
@@ -0,0 +1,69 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/startup_profile.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace
+{
+double seconds_between(VW::details::startup_profile::clock::time_point from,
+    VW::details::startup_profile::clock::time_point to)
+{
+  return std::chrono::duration<double>(to - from).count();
+}
+}  // namespace
+
+void VW::details::startup_profile::start(clock::time_point start_time) { _phase_start = start_time; }
+
+void VW::details::startup_profile::end_phase(const std::string& name)
+{
+  const auto now = clock::now();
+  phases.push_back(entry{name, seconds_between(_phase_start, now)});
+  _phase_start = now;
+}
+
+void VW::details::startup_profile::add_reduction(const std::string& name, double seconds)
+{
+  reductions.push_back(entry{name, seconds});
+}
+
+std::string VW::details::startup_profile::to_string() const
+{
+  fmt::memory_buffer buffer;
+  fmt::format_to(std::back_inserter(buffer), "{:<32}{:>12}\n", "Startup phase", "ms");
+  double total = 0.0;
+  for (const auto& phase : phases)
+  {
+    fmt::format_to(std::back_inserter(buffer), "{:<32}{:>12.3f}\n", phase.name, phase.seconds * 1000.0);
+    total += phase.seconds;
+  }
+  fmt::format_to(std::back_inserter(buffer), "{:<32}{:>12.3f}\n", "total", total * 1000.0);
+
+  auto sorted = reductions;
+  std::stable_sort(
+      sorted.begin(), sorted.end(), [](const entry& a, const entry& b) { return a.seconds > b.seconds; });
+  fmt::format_to(std::back_inserter(buffer), "{:<32}{:>12}\n", "Reduction setup", "ms");
+  size_t num_unlisted = 0;
+  double unlisted_seconds = 0.0;
+  for (const auto& reduction : sorted)
+  {
+    if (reduction.seconds < MIN_LISTED_SECONDS)
+    {
+      num_unlisted++;
+      unlisted_seconds += reduction.seconds;
+      continue;
+    }
+    fmt::format_to(std::back_inserter(buffer), "{:<32}{:>12.3f}\n", reduction.name, reduction.seconds * 1000.0);
+  }
+  if (num_unlisted > 0)
+  {
+    fmt::format_to(std::back_inserter(buffer), "{:<32}{:>12.3f}\n", fmt::format("{} others", num_unlisted),
+        unlisted_seconds * 1000.0);
+  }
+  return fmt::to_string(buffer);
+}
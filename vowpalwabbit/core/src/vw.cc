@@ -19,22 +19,60 @@
 #include "vw/core/reductions/conditional_contextual_bandit.h"
 #include "vw/core/reductions/gd.h"
 #include "vw/core/reductions/metrics.h"
+#include "vw/core/scope_exit.h"
 #include "vw/core/shared_data.h"
 #include "vw/core/unique_sort.h"
 #include "vw/text_parser/parse_example_text.h"
 
+#include <cstring>
 #include <iostream>
 
 namespace
 {
+// Hogwild learner threads each run their own copy of the learner stack, so every reduction in it must keep its state
+// per instance and only touch the shared weights. Plain gd does; anything that keeps global state in learn is refused.
+void check_learner_threads_supported(const VW::workspace& all, const std::vector<std::string>& enabled_learners)
+{
+  for (const auto& name : enabled_learners)
+  {
+    const bool supported =
+        name == "gd" || name == "count_label" || name == "binary" || name.compare(0, 6, "scorer") == 0;
+    if (!supported)
+    {
+      THROW("--learner_threads only supports gd with a scorer, binary and count_label, found " << name);
+    }
+  }
+  if (all.weights.sparse)
+  {
+    THROW("--learner_threads requires dense weights and cannot be used with --sparse_weights");
+  }
+  if (all.loss_config.l1_lambda > 0.f || all.loss_config.l2_lambda > 0.f)
+  {
+    THROW("--learner_threads cannot be used with --l1 or --l2, they update shared regularization state in learn");
+  }
+  if (all.output_config.audit || all.output_config.hash_inv)
+  {
+    THROW("--learner_threads cannot be used with --audit or --invert_hash");
+  }
+  // Examples are finished in the order the threads complete them, so written predictions would not line up with the
+  // input.
+  if (!all.output_runtime.final_prediction_sink.empty() || all.output_runtime.raw_prediction != nullptr)
+  {
+    THROW("--learner_threads cannot be used with --predictions or --raw_predictions");
+  }
+}
 
 std::unique_ptr<VW::workspace> initialize_internal(
     std::unique_ptr<VW::config::options_i, VW::options_deleter_type> options, VW::io_buf* model, bool skip_model_load,
     VW::trace_message_t trace_listener, void* trace_context, VW::io::logger* custom_logger,
     std::unique_ptr<VW::setup_base_i> setup_base = nullptr)
 {
+  const auto start_time = VW::details::startup_profile::clock::now();
   // Set up logger as early as possible
   auto all = VW::details::parse_args(std::move(options), trace_listener, trace_context, custom_logger);
+  auto& startup_profile = all->runtime_state.startup_profile;
+  startup_profile.start(start_time);
+  startup_profile.end_phase("parse_args");
 
   // if user doesn't pass in a model, read from options
   VW::io_buf local_model;
@@ -47,6 +85,7 @@ std::unique_ptr<VW::workspace> initialize_internal(
     }
     VW::details::read_regressor_file(*all, all_initial_regressor_files, local_model);
     model = &local_model;
+    startup_profile.end_phase("open_model_files");
   }
 
   std::vector<std::string> dictionary_namespaces;
@@ -55,9 +94,12 @@ std::unique_ptr<VW::workspace> initialize_internal(
     // Loads header of model files and loads the command line options into the options object.
     bool interactions_settings_duplicated{};
     VW::details::load_header_merge_options(*all->options, *all, *model, interactions_settings_duplicated);
+    startup_profile.end_phase("load_model_header");
 
     VW::details::parse_modules(*all->options, *all, interactions_settings_duplicated, dictionary_namespaces);
+    startup_profile.end_phase("parse_modules");
     VW::details::instantiate_learner(*all, std::move(setup_base));
+    startup_profile.end_phase("setup_reductions");
     VW::details::parse_sources(*all->options, *all, *model, skip_model_load);
   }
   catch (VW::save_load_model_exception& e)
@@ -87,9 +129,11 @@ std::unique_ptr<VW::workspace> initialize_internal(
 
   // we must delay so parse_mask is fully defined.
   for (const auto& name_space : dictionary_namespaces) { VW::details::parse_dictionary_argument(*all, name_space); }
+  startup_profile.end_phase("load_dictionaries");
 
   std::vector<std::string> enabled_learners;
   if (all->l != nullptr) { all->l->get_enabled_learners(enabled_learners); }
+  if (all->runtime_config.learner_threads > 1) { check_learner_threads_supported(*all, enabled_learners); }
 
   // upon direct query for help -- spit it out to stdout;
   if (all->options->get_typed_option<bool>("help").value())
@@ -135,6 +179,11 @@ std::unique_ptr<VW::workspace> initialize_internal(
                                          << VW::to_string(all->l->get_output_prediction_type()).substr(19) << std::endl;
   }
 
+  if (all->options->get_typed_option<bool>("startup_profile").value())
+  {
+    *(all->output_runtime.trace_message) << startup_profile.to_string();
+  }
+
   if (!all->options->get_typed_option<bool>("dry_run").value())
   {
     if (!all->output_config.quiet && !all->reduction_state.bfgs && (all->reduction_state.searchstr == nullptr) &&
@@ -342,6 +391,61 @@ std::unique_ptr<VW::workspace> VW::seed_vw_model(VW::workspace& vw_model, const
   return new_model;
 }
 
+std::unique_ptr<VW::workspace> VW::clone_workspace(const VW::workspace& ws, VW::io::logger* custom_logger)
+{
+  const auto& weights = ws.weights;
+
+  config::cli_options_serializer serializer;
+  for (auto const& option : ws.options->get_all_options())
+  {
+    if (ws.options->was_supplied(option->m_name) && option->m_keep) { serializer.add(*option); }
+  }
+  auto command_line = VW::split_command_line(serializer.str());
+  if (custom_logger == nullptr) { command_line.emplace_back("--quiet"); }
+  else { command_line.emplace_back("--driver_output_off"); }
+  command_line.emplace_back("--preserve_performance_counters");
+  // The weight storage is not recorded in the model but the copy below needs the same layout.
+  if (weights.sparse) { command_line.emplace_back("--sparse_weights"); }
+
+  // Save everything but the weights, they are copied directly below.
+  auto skeleton = std::make_shared<std::vector<char>>();
+  {
+    io_buf buffer;
+    buffer.skip_weights(true);
+    buffer.add_file(VW::io::create_vector_writer(skeleton));
+    // Saving with weights skipped leaves the workspace unchanged, save_predictor is only non-const for full saves.
+    VW::save_predictor(const_cast<VW::workspace&>(ws), buffer);
+  }
+
+  auto clone = VW::initialize(VW::make_unique<config::options_cli>(command_line),
+      VW::io::create_buffer_view(skeleton->data(), skeleton->size()), nullptr, nullptr, custom_logger);
+
+  auto& clone_weights = clone->weights;
+  if (clone_weights.sparse != weights.sparse || clone_weights.mask() != weights.mask() ||
+      clone_weights.stride_shift() != weights.stride_shift())
+  {
+    THROW("Cloned workspace has a different weight layout than the source workspace");
+  }
+
+  // Copy into the existing allocation so that anything already holding on to the clone's weights stays valid.
+  if (weights.sparse)
+  {
+    const auto stride = weights.stride();
+    for (auto it = weights.sparse_weights.cbegin(); it != weights.sparse_weights.cend(); ++it)
+    {
+      const auto* source_row = &(*it);
+      std::copy(source_row, source_row + stride, &clone_weights.sparse_weights[it.index()]);
+    }
+  }
+  else
+  {
+    std::memcpy(clone_weights.dense_weights.data(), weights.dense_weights.data(),
+        weights.dense_weights.raw_length() * sizeof(VW::weight));
+  }
+
+  return clone;
+}
+
 VW::workspace* VW::initialize_with_builder(const std::string& s, io_buf* model, bool skip_model_load,
     VW::trace_message_t trace_listener, void* trace_context, std::unique_ptr<VW::setup_base_i> setup_base)
 {
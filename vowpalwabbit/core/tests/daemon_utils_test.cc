@@ -0,0 +1,50 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/daemon_utils.h"
+
+#include "vw/common/vw_exception.h"
+#include "vw/io/io_adapter.h"
+#include "vw/io/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+TEST(DaemonUtils, GetPredictionReadsWhatWasSent)
+{
+  auto backing_vector = std::make_shared<std::vector<char>>();
+  auto writer = VW::io::create_vector_writer(backing_vector);
+  auto logger = VW::io::create_null_logger();
+  VW::details::binary_print_result_by_ref(writer.get(), 0.25f, 2.f, VW::v_array<char>(), logger);
+  VW::details::binary_print_result_by_ref(writer.get(), -1.5f, 1.f, VW::v_array<char>(), logger);
+
+  auto reader = VW::io::create_buffer_view(backing_vector->data(), backing_vector->size());
+  float prediction = 0.f;
+  float weight = 0.f;
+  VW::details::get_prediction(reader.get(), prediction, weight);
+  EXPECT_FLOAT_EQ(prediction, 0.25f);
+  EXPECT_FLOAT_EQ(weight, 2.f);
+  VW::details::get_prediction(reader.get(), prediction, weight);
+  EXPECT_FLOAT_EQ(prediction, -1.5f);
+  EXPECT_FLOAT_EQ(weight, 1.f);
+
+  // The sender relies on this to stop instead of reporting a zeroed prediction.
+  EXPECT_THROW(VW::details::get_prediction(reader.get(), prediction, weight), VW::vw_exception);
+}
+
+TEST(DaemonUtils, GetPredictionThrowsOnShortRead)
+{
+  auto backing_vector = std::make_shared<std::vector<char>>();
+  auto writer = VW::io::create_vector_writer(backing_vector);
+  auto logger = VW::io::create_null_logger();
+  VW::details::binary_print_result_by_ref(writer.get(), 0.25f, 2.f, VW::v_array<char>(), logger);
+
+  // The connection closes after half of a prediction.
+  auto reader = VW::io::create_buffer_view(backing_vector->data(), backing_vector->size() / 2);
+  float prediction = 0.f;
+  float weight = 0.f;
+  EXPECT_THROW(VW::details::get_prediction(reader.get(), prediction, weight), VW::vw_exception);
+}
@@ -143,9 +143,9 @@ TEST(EigenMemoryTree, Bounding)
     vw->finish_example(*ex);
   }
 
-  EXPECT_EQ(tree->bounder->list.size(), 5);
-  EXPECT_EQ(tree->root->examples.size(), 5);
-  EXPECT_EQ(tree->root->router_weights.size(), 0);
+  EXPECT_EQ(tree->bounder->size(), 5);
+  EXPECT_EQ(tree->root().examples.size(), 5);
+  EXPECT_EQ(tree->root().router_weights.size(), 0);
 }
 
 TEST(EigenMemoryTree, Split)
@@ -161,15 +161,48 @@ TEST(EigenMemoryTree, Split)
     vw->finish_example(*ex);
   }
 
-  EXPECT_EQ(tree->bounder->list.size(), 4);
+  EXPECT_EQ(tree->bounder->size(), 4);
 
-  EXPECT_EQ(tree->root->examples.size(), 0);
-  EXPECT_EQ(tree->root->left->examples.size(), 2);
-  EXPECT_EQ(tree->root->right->examples.size(), 2);
+  EXPECT_EQ(tree->root().examples.size(), 0);
+  EXPECT_EQ(tree->node(tree->root().left).examples.size(), 2);
+  EXPECT_EQ(tree->node(tree->root().right).examples.size(), 2);
 
-  EXPECT_GE(tree->root->router_weights.size(), 0);
-  EXPECT_EQ(tree->root->right->router_weights.size(), 0);
-  EXPECT_EQ(tree->root->left->router_weights.size(), 0);
+  EXPECT_GE(tree->root().router_weights.size(), 0);
+  EXPECT_EQ(tree->node(tree->root().right).router_weights.size(), 0);
+  EXPECT_EQ(tree->node(tree->root().left).router_weights.size(), 0);
+}
+
+TEST(EigenMemoryTree, BoundingReusesSlots)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "--emt", "--emt_tree", "5"));
+  auto* tree = get_emt_tree(*vw);
+
+  for (int i = 0; i < 100; i++)
+  {
+    auto* ex = VW::read_example(*vw, std::to_string(i) + " | " + std::to_string(i));
+    vw->learn(*ex);
+    vw->finish_example(*ex);
+  }
+
+  EXPECT_EQ(tree->bounder->size(), 5);
+  EXPECT_EQ(tree->num_memories(), 5);
+  EXPECT_LE(tree->examples.size(), 6);
+}
+
+TEST(EigenMemoryTree, Lru)
+{
+  emt_lru lru(2);
+
+  EXPECT_EQ(lru.bound(0), EMT_NULL_INDEX);
+  EXPECT_EQ(lru.bound(1), EMT_NULL_INDEX);
+  EXPECT_EQ(lru.bound(0), EMT_NULL_INDEX);
+  EXPECT_EQ(lru.bound(2), 1);
+  EXPECT_EQ(lru.size(), 2);
+
+  lru.erase(0);
+  EXPECT_EQ(lru.size(), 1);
+  EXPECT_EQ(lru.bound(3), EMT_NULL_INDEX);
+  EXPECT_EQ(lru.bound(4), 2);
 }
 
 TEST(EigenMemoryTree, Inner)
@@ -357,6 +390,112 @@ TEST(EigenMemoryTree, ScorerInitial)
   EXPECT_NEAR(emt_initial(emt_initial_type::COSINE, v1, v2), 1.98, .001);
 }
 
+TEST(EigenMemoryTree, Distance)
+{
+  emt_feats v1{{1, -2}, {3, 4}, {5, 3}};
+  emt_feats v2{{1, 1}, {5, -1}, {7, 2}};
+
+  EXPECT_FLOAT_EQ(emt_distance(v1, v2), emt_norm(emt_scale_add(1, v1, -1, v2)));
+  EXPECT_FLOAT_EQ(emt_distance(v2, v1), emt_norm(emt_scale_add(1, v2, -1, v1)));
+  EXPECT_EQ(emt_distance(v1, v1), 0);
+  EXPECT_EQ(emt_distance(v1, emt_feats{}), emt_norm(v1));
+}
+
+TEST(EigenMemoryTree, ScanThreadsMatchSerial)
+{
+  auto vw_serial = VW::initialize(vwtest::make_args("--quiet", "--emt", "--emt_leaf", "200"));
+  auto vw_threads =
+      VW::initialize(vwtest::make_args("--quiet", "--emt", "--emt_leaf", "200", "--emt_threads", "4"));
+
+  for (int i = 0; i < 150; i++)
+  {
+    const auto line = std::to_string(i % 10) + " | 1:" + std::to_string(i % 10) + " " + std::to_string(i);
+    auto* ex_serial = VW::read_example(*vw_serial, line);
+    auto* ex_threads = VW::read_example(*vw_threads, line);
+    vw_serial->learn(*ex_serial);
+    vw_threads->learn(*ex_threads);
+    EXPECT_EQ(ex_serial->pred.multiclass, ex_threads->pred.multiclass);
+    vw_serial->finish_example(*ex_serial);
+    vw_threads->finish_example(*ex_threads);
+  }
+
+  for (int i = 0; i < 10; i++)
+  {
+    const auto line = " | 1:" + std::to_string(i + 0.1);
+    auto* ex_serial = VW::read_example(*vw_serial, line);
+    auto* ex_threads = VW::read_example(*vw_threads, line);
+    vw_serial->predict(*ex_serial);
+    vw_threads->predict(*ex_threads);
+    EXPECT_EQ(ex_serial->pred.multiclass, ex_threads->pred.multiclass);
+    vw_serial->finish_example(*ex_serial);
+    vw_threads->finish_example(*ex_threads);
+  }
+}
+
+namespace
+{
+// A memory with a few weighted features in each of two bands, so that memories are neither identical nor disjoint.
+std::string large_leaf_line(int i)
+{
+  return std::to_string(i % 7) + " | a" + std::to_string(i % 13) + ":" + std::to_string(1 + i % 5) + " b" +
+      std::to_string(i % 11) + ":0.5 c" + std::to_string(i);
+}
+
+// Learns 200 memories into one leaf and returns the predictions made while learning and afterwards.
+std::vector<uint32_t> large_leaf_predictions(VW::workspace& vw)
+{
+  std::vector<uint32_t> predictions;
+  for (int i = 0; i < 200; i++)
+  {
+    auto* ex = VW::read_example(vw, large_leaf_line(i));
+    vw.learn(*ex);
+    predictions.push_back(ex->pred.multiclass);
+    vw.finish_example(*ex);
+  }
+  for (int i = 0; i < 40; i++)
+  {
+    auto* ex = VW::read_example(vw, " | a" + std::to_string(i % 13) + ":2 b" + std::to_string(i % 11) + ":0.5");
+    vw.predict(*ex);
+    predictions.push_back(ex->pred.multiclass);
+    vw.finish_example(*ex);
+  }
+  return predictions;
+}
+
+std::vector<float> weights_of(VW::workspace& vw)
+{
+  std::vector<float> weights;
+  for (auto it = vw.weights.dense_weights.begin(); it != vw.weights.dense_weights.end(); ++it)
+  {
+    weights.push_back(*it);
+  }
+  return weights;
+}
+}  // namespace
+
+// The scan pool only splits leaves of at least two blocks of 32 memories, which every scan here exceeds after the
+// first 64 memories.
+TEST(EigenMemoryTree, ScanThreadsMatchSerialOnLargeLeaves)
+{
+  for (const char* scorer : {"self_consistent_rank", "not_self_consistent_rank", "distance"})
+  {
+    auto vw_serial =
+        VW::initialize(vwtest::make_args("--quiet", "--emt", "--emt_leaf", "500", "--emt_scorer", scorer));
+    auto vw_threads = VW::initialize(
+        vwtest::make_args("--quiet", "--emt", "--emt_leaf", "500", "--emt_scorer", scorer, "--emt_threads", "3"));
+
+    const auto serial = large_leaf_predictions(*vw_serial);
+    const auto threads = large_leaf_predictions(*vw_threads);
+
+    auto* tree = get_emt_tree(*vw_threads);
+    ASSERT_TRUE(tree->root().is_leaf());
+    EXPECT_EQ(tree->root().examples.size(), 200) << scorer;
+    EXPECT_EQ(serial, threads) << scorer;
+
+    EXPECT_EQ(weights_of(*vw_serial), weights_of(*vw_threads)) << scorer;
+  }
+}
+
 TEST(EigenMemoryTree, Shuffle)
 {
   VW::rand_state rng(2);
@@ -0,0 +1,126 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/config/options_cli.h"
+#include "vw/core/example.h"
+#include "vw/core/learner.h"
+#include "vw/core/parser.h"
+#include "vw/core/shared_data.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+using workspaces = std::vector<std::unique_ptr<VW::workspace>>;
+
+workspaces make_instances(const std::vector<std::vector<std::string>>& configs, bool instance_threads)
+{
+  workspaces instances;
+  for (const auto& config : configs)
+  {
+    std::vector<std::string> args = {"--quiet", "--no_stdin", "--example_queue_limit", "1024"};
+    args.insert(args.end(), config.begin(), config.end());
+    if (instance_threads && instances.empty()) { args.emplace_back("--instance_threads"); }
+    instances.push_back(VW::initialize(VW::make_unique<VW::config::options_cli>(args)));
+  }
+  return instances;
+}
+
+// Feeds the lines through the first instance's ready example queue, as the parser thread would, and runs the driver.
+void run_driver(workspaces& instances, const std::vector<std::string>& lines)
+{
+  auto& master = *instances.front();
+  auto& queue = master.parser_runtime.example_parser->ready_parsed_examples;
+  std::vector<VW::example*> examples;
+  for (const auto& line : lines) { examples.push_back(VW::read_example(master, line)); }
+  for (auto* ex : examples) { queue.push(ex); }
+  queue.set_done();
+
+  std::vector<VW::workspace*> ptrs;
+  for (auto& instance : instances) { ptrs.push_back(instance.get()); }
+  VW::LEARNER::generic_driver(ptrs);
+}
+
+void expect_same_results(const workspaces& sequential, const workspaces& concurrent)
+{
+  ASSERT_EQ(sequential.size(), concurrent.size());
+  for (size_t i = 0; i < sequential.size(); i++)
+  {
+    EXPECT_EQ(concurrent[i]->sd->example_number, sequential[i]->sd->example_number) << i;
+    EXPECT_EQ(concurrent[i]->sd->sum_loss, sequential[i]->sd->sum_loss) << i;
+    EXPECT_EQ(concurrent[i]->sd->weighted_labeled_examples, sequential[i]->sd->weighted_labeled_examples) << i;
+  }
+}
+}  // namespace
+
+TEST(InstanceThreads, SingleLineMatchesSequentialInstances)
+{
+  const std::vector<std::vector<std::string>> configs = {
+      {"-l", "0.1"}, {"-l", "1", "-q", "ab"}, {"--loss_function", "logistic", "--binary"}, {"--invariant"}};
+  std::vector<std::string> lines;
+  for (int i = 0; i < 500; i++)
+  {
+    const std::string label = (i % 3 == 0) ? "-1" : "1";
+    lines.push_back(label + " 2 |a x" + std::to_string(i % 7) + " y:" + std::to_string(i % 5) + " |b z" +
+        std::to_string(i % 11));
+  }
+
+  auto sequential = make_instances(configs, false);
+  run_driver(sequential, lines);
+  auto concurrent = make_instances(configs, true);
+  run_driver(concurrent, lines);
+  expect_same_results(sequential, concurrent);
+
+  for (size_t i = 0; i < concurrent.size(); i++)
+  {
+    EXPECT_EQ(concurrent[i]->sd->example_number, lines.size());
+    auto* seq_ex = VW::read_example(*sequential[i], "|a x3 y:2 |b z4");
+    auto* con_ex = VW::read_example(*concurrent[i], "|a x3 y:2 |b z4");
+    sequential[i]->predict(*seq_ex);
+    concurrent[i]->predict(*con_ex);
+    EXPECT_EQ(con_ex->pred.scalar, seq_ex->pred.scalar) << i;
+    sequential[i]->finish_example(*seq_ex);
+    concurrent[i]->finish_example(*con_ex);
+  }
+}
+
+TEST(InstanceThreads, MultilineMatchesSequentialInstances)
+{
+  const std::vector<std::vector<std::string>> configs = {
+      {"--cb_adf"}, {"--cb_adf", "-q", "sa"}, {"--cb_adf", "--cb_type", "dr", "-l", "0.2"}};
+  std::vector<std::string> lines;
+  for (int i = 0; i < 200; i++)
+  {
+    lines.push_back("shared |s u" + std::to_string(i % 5));
+    for (int a = 0; a < 3; a++)
+    {
+      const std::string label = (a == i % 3) ? "0:" + std::to_string((i + a) % 2) + ":0.5 " : "";
+      lines.push_back(label + "|a act" + std::to_string(a) + " f" + std::to_string((i + a) % 4));
+    }
+    lines.push_back("");
+  }
+
+  auto sequential = make_instances(configs, false);
+  run_driver(sequential, lines);
+  auto concurrent = make_instances(configs, true);
+  run_driver(concurrent, lines);
+  expect_same_results(sequential, concurrent);
+  EXPECT_EQ(concurrent.front()->sd->example_number, 200u);
+}
+
+TEST(InstanceThreads, RejectsLearnerThreads)
+{
+  auto instances = make_instances({{}, {"--learner_threads", "2"}}, true);
+  std::vector<VW::workspace*> ptrs;
+  for (auto& instance : instances) { ptrs.push_back(instance.get()); }
+  instances.front()->parser_runtime.example_parser->ready_parsed_examples.set_done();
+  EXPECT_THROW(VW::LEARNER::generic_driver(ptrs), VW::vw_exception);
+}
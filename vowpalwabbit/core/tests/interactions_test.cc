@@ -21,6 +21,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <random>
+#include <string>
 #include <vector>
 
 using namespace ::testing;
@@ -535,4 +537,41 @@ TEST(Interactions, ExtentVsCharInteractionsCubicWildcardPermutationsConstant)
 TEST(Interactions, ExtentVsCharInteractionsCubicWildcardPermutationsCombinationsConstant)
 {
   do_interaction_feature_count_test(true, true, true, false);
-}
\ No newline at end of file
+}
+
+TEST(Interactions, PrefetchingDoesNotChangeLearning)
+{
+  // Pairs, triples and the generic expansion each prefetch on their own path.
+  auto plain = VW::initialize(
+      vwtest::make_args("--quiet", "-b", "18", "-q", "ab", "--cubic", "abc", "--interactions", "abcd"));
+  auto prefetching = VW::initialize(vwtest::make_args("--quiet", "-b", "18", "-q", "ab", "--cubic", "abc",
+      "--interactions", "abcd", "--weights_prefetch_distance", "4"));
+  EXPECT_EQ(prefetching->weights.dense_weights.prefetch_distance(), 4);
+
+  std::mt19937 rng(11);
+  std::uniform_int_distribution<int> index(0, 999);
+  for (int i = 0; i < 200; i++)
+  {
+    std::string line = std::to_string(i % 3 - 1);
+    for (const char* ns : {" |a", " |b", " |c", " |d"})
+    {
+      line += ns;
+      for (int j = 0; j < 7; j++) { line += " f" + std::to_string(index(rng)); }
+    }
+    auto* plain_ex = VW::read_example(*plain, line);
+    auto* prefetching_ex = VW::read_example(*prefetching, line);
+    plain->learn(*plain_ex);
+    prefetching->learn(*prefetching_ex);
+    EXPECT_EQ(prefetching_ex->pred.scalar, plain_ex->pred.scalar) << i;
+    plain->finish_example(*plain_ex);
+    prefetching->finish_example(*prefetching_ex);
+  }
+
+  const auto& plain_weights = plain->weights.dense_weights;
+  const auto& prefetching_weights = prefetching->weights.dense_weights;
+  for (uint64_t i = 0; i < plain_weights.raw_length(); i++) { ASSERT_EQ(prefetching_weights[i], plain_weights[i]) << i; }
+
+  EXPECT_THROW(
+      VW::initialize(vwtest::make_args("--quiet", "--sparse_weights", "--weights_prefetch_distance", "4")),
+      VW::vw_exception);
+}
@@ -0,0 +1,97 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/config/options_cli.h"
+#include "vw/core/example.h"
+#include "vw/core/learner.h"
+#include "vw/core/metric_sink.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Noisy labels keep most examples as support vectors, so kernel rows grow past the kernel block size.
+std::vector<std::string> make_lines(size_t count, uint32_t seed)
+{
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> index(0, 99);
+  std::uniform_real_distribution<float> value(0.f, 1.f);
+
+  std::vector<std::string> lines;
+  for (size_t i = 0; i < count; i++)
+  {
+    std::stringstream ss;
+    ss << (value(rng) > 0.5f ? "1" : "-1") << " |";
+    for (int j = 0; j < 8; j++) { ss << " f" << index(rng) << ":" << value(rng); }
+    lines.push_back(ss.str());
+  }
+  return lines;
+}
+
+struct trained_svm
+{
+  std::vector<float> predictions;
+  VW::metric_sink metrics;
+};
+
+trained_svm train_and_predict(const std::vector<std::string>& extra_args)
+{
+  std::vector<std::string> args = {"--quiet", "--ksvm", "--kernel", "rbf", "--l2", "0.01", "--extra_metrics",
+      "unused.json"};
+  args.insert(args.end(), extra_args.begin(), extra_args.end());
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+
+  trained_svm result;
+  for (const auto& line : make_lines(1500, 5))
+  {
+    auto* ex = VW::read_example(*vw, line);
+    vw->learn(*ex);
+    vw->finish_example(*ex);
+  }
+  for (const auto& line : make_lines(50, 6))
+  {
+    auto* ex = VW::read_example(*vw, line);
+    vw->predict(*ex);
+    result.predictions.push_back(ex->pred.scalar);
+    vw->finish_example(*ex);
+  }
+  result.metrics = vw->output_runtime.global_metrics.collect_metrics(vw->l.get());
+  return result;
+}
+}  // namespace
+
+TEST(KernelSvm, EvictedRowsPredictLikeUnboundedCache)
+{
+  const auto unbounded = train_and_predict({});
+  // A zero budget evicts every cached row each time the cache is trimmed.
+  const auto bounded = train_and_predict({"--kernel_cache_mb", "0"});
+
+  EXPECT_EQ(unbounded.metrics.get_uint("ksvm_kernel_cache_evictions"), 0);
+  EXPECT_GT(bounded.metrics.get_uint("ksvm_kernel_cache_evictions"), 0);
+  // Evicted rows are computed again on their next use.
+  EXPECT_GT(
+      bounded.metrics.get_uint("ksvm_kernel_cache_misses"), unbounded.metrics.get_uint("ksvm_kernel_cache_misses"));
+  EXPECT_EQ(bounded.metrics.get_uint("ksvm_num_support"), unbounded.metrics.get_uint("ksvm_num_support"));
+  EXPECT_EQ(bounded.predictions, unbounded.predictions);
+}
+
+TEST(KernelSvm, ThreadedRowsMatchSingleThread)
+{
+  const auto serial = train_and_predict({});
+  const auto threaded = train_and_predict({"--kernel_threads", "3"});
+
+  // Rows are only split across the pool once there are at least two blocks of support vectors.
+  EXPECT_GE(serial.metrics.get_uint("ksvm_num_support"), 512);
+  EXPECT_EQ(threaded.metrics.get_uint("ksvm_num_support"), serial.metrics.get_uint("ksvm_num_support"));
+  EXPECT_EQ(threaded.metrics.get_uint("ksvm_kernel_cache_hits"), serial.metrics.get_uint("ksvm_kernel_cache_hits"));
+  EXPECT_EQ(threaded.predictions, serial.predictions);
+}
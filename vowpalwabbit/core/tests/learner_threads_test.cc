@@ -0,0 +1,162 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/config/options_cli.h"
+#include "vw/core/example.h"
+#include "vw/core/learner.h"
+#include "vw/core/parser.h"
+#include "vw/core/reductions/gd.h"
+#include "vw/core/shared_data.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::vector<std::string> make_linear_dataset(size_t count)
+{
+  std::mt19937 rng(13);
+  std::uniform_int_distribution<int> index(0, 99);
+  std::uniform_real_distribution<float> value(0.f, 1.f);
+
+  std::vector<std::string> lines;
+  for (size_t i = 0; i < count; i++)
+  {
+    std::stringstream features;
+    float label = 0.f;
+    for (int j = 0; j < 10; j++)
+    {
+      const int idx = index(rng);
+      const float x = value(rng);
+      label += (idx % 2 == 0 ? 1.f : -1.f) * x;
+      features << " f" << idx << ":" << x;
+    }
+    lines.push_back(std::to_string(label) + " |" + features.str());
+  }
+  return lines;
+}
+
+const VW::reductions::details::gd_per_model_state& gd_state(VW::workspace& vw)
+{
+  auto* gd_learner = vw.l->get_learner_by_name_prefix("gd");
+  return static_cast<VW::reductions::gd*>(gd_learner->get_internal_type_erased_data_pointer_test_use_only())
+      ->gd_per_model_states[0];
+}
+
+// Feeds the lines through the ready example queue, as the parser thread would, and runs the driver.
+void run_driver(VW::workspace& vw, const std::vector<std::string>& lines)
+{
+  auto& queue = vw.parser_runtime.example_parser->ready_parsed_examples;
+  std::vector<VW::example*> examples;
+  for (const auto& line : lines) { examples.push_back(VW::read_example(vw, line)); }
+  // Examples are only read from the queue once it is done, so it must hold all of them.
+  for (auto* ex : examples) { queue.push(ex); }
+  queue.set_done();
+  VW::LEARNER::generic_driver(vw);
+}
+}  // namespace
+
+// gd only counts an example in its normalization totals when the loss is positive, and a prediction clipped to the
+// label range has no loss when the label is at its edge. The order Hogwild learns in decides whether that happens, so
+// the tests that compare totals exactly use a prediction range wider than the labels.
+TEST(LearnerThreads, LearnsEveryExampleOnSharedWeights)
+{
+  const auto lines = make_linear_dataset(2000);
+
+  auto single = VW::initialize(vwtest::make_args(
+      "--quiet", "--example_queue_limit", "4096", "--min_prediction", "-50", "--max_prediction", "50"));
+  run_driver(*single, lines);
+
+  auto threaded = VW::initialize(vwtest::make_args("--quiet", "--example_queue_limit", "4096", "--min_prediction",
+      "-50", "--max_prediction", "50", "--learner_threads", "4"));
+  run_driver(*threaded, lines);
+
+  EXPECT_EQ(threaded->sd->example_number, single->sd->example_number);
+  EXPECT_DOUBLE_EQ(threaded->sd->weighted_labeled_examples, 2000.0);
+
+  // Hogwild changes the order of updates, not what is learned.
+  const double single_loss = single->sd->sum_loss / single->sd->weighted_labeled_examples;
+  const double threaded_loss = threaded->sd->sum_loss / threaded->sd->weighted_labeled_examples;
+  EXPECT_NEAR(threaded_loss, single_loss, 0.1 * single_loss);
+
+  // The threads' normalization totals end up in the master, which is what a saved model resumes from.
+  EXPECT_DOUBLE_EQ(gd_state(*threaded).total_weight, gd_state(*single).total_weight);
+
+  auto* test_ex = VW::read_example(*threaded, "| f0:1 f2:1 f1:1");
+  threaded->predict(*test_ex);
+  EXPECT_NEAR(test_ex->pred.scalar, 1.f, 0.5f);
+  threaded->finish_example(*test_ex);
+}
+
+TEST(LearnerThreads, MergesLabelRangeIntoMaster)
+{
+  const auto lines = make_linear_dataset(2000);
+
+  auto single = VW::initialize(vwtest::make_args("--quiet", "--example_queue_limit", "4096"));
+  run_driver(*single, lines);
+
+  auto threaded =
+      VW::initialize(vwtest::make_args("--quiet", "--example_queue_limit", "4096", "--learner_threads", "4"));
+  run_driver(*threaded, lines);
+
+  EXPECT_FLOAT_EQ(threaded->sd->min_label, single->sd->min_label);
+  EXPECT_FLOAT_EQ(threaded->sd->max_label, single->sd->max_label);
+  EXPECT_TRUE(threaded->sd->is_more_than_two_labels_observed);
+}
+
+TEST(LearnerThreads, ResumesFromSavedModel)
+{
+  const auto lines = make_linear_dataset(2000);
+  const std::vector<std::string> first_half(lines.begin(), lines.begin() + 1000);
+  const std::vector<std::string> second_half(lines.begin() + 1000, lines.end());
+
+  auto initial = VW::initialize(vwtest::make_args(
+      "--quiet", "--example_queue_limit", "4096", "--min_prediction", "-50", "--max_prediction", "50"));
+  run_driver(*initial, first_half);
+  auto backing_vector = std::make_shared<std::vector<char>>();
+  VW::io_buf io_writer;
+  io_writer.add_file(VW::io::create_vector_writer(backing_vector));
+  VW::save_predictor(*initial, io_writer);
+  io_writer.flush();
+
+  auto load = [&backing_vector](const std::string& threads)
+  {
+    return VW::initialize(vwtest::make_args("--quiet", "--example_queue_limit", "4096", "--min_prediction", "-50",
+                              "--max_prediction", "50", "--learner_threads", threads),
+        VW::io::create_buffer_view(backing_vector->data(), backing_vector->size()));
+  };
+  auto single = load("1");
+  run_driver(*single, second_half);
+  auto threaded = load("4");
+  run_driver(*threaded, second_half);
+
+  // The threads continue from the loaded normalization totals and the master counts them once.
+  EXPECT_DOUBLE_EQ(gd_state(*threaded).total_weight, gd_state(*single).total_weight);
+  EXPECT_DOUBLE_EQ(gd_state(*threaded).total_weight, 2000.0);
+  EXPECT_DOUBLE_EQ(threaded->sd->weighted_labeled_examples, single->sd->weighted_labeled_examples);
+
+  const double single_loss = single->sd->sum_loss / single->sd->weighted_labeled_examples;
+  const double threaded_loss = threaded->sd->sum_loss / threaded->sd->weighted_labeled_examples;
+  EXPECT_NEAR(threaded_loss, single_loss, 0.1 * single_loss);
+}
+
+TEST(LearnerThreads, RejectsUnsupportedSetups)
+{
+  const std::vector<std::vector<std::string>> unsupported = {{"--oaa", "3"}, {"--sparse_weights"}, {"--l1", "0.001"},
+      {"--audit"}, {"--bfgs"}, {"--predictions", "/dev/null"}, {"--raw_predictions", "/dev/null"}};
+  for (const auto& extra : unsupported)
+  {
+    std::vector<std::string> args = {"--quiet", "--learner_threads", "2"};
+    args.insert(args.end(), extra.begin(), extra.end());
+    EXPECT_THROW(VW::initialize(VW::make_unique<VW::config::options_cli>(args)), VW::vw_exception) << extra[0];
+  }
+  EXPECT_THROW(VW::initialize(vwtest::make_args("--quiet", "--learner_threads", "0")), VW::vw_exception);
+}
@@ -0,0 +1,108 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/config/options_cli.h"
+#include "vw/core/example.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Examples with several features in each of the namespaces a, b and c.
+std::vector<std::string> make_lines(size_t count)
+{
+  std::mt19937 rng(11);
+  std::uniform_int_distribution<int> index(0, 19);
+  std::uniform_real_distribution<float> value(0.f, 1.f);
+
+  std::vector<std::string> lines;
+  for (size_t i = 0; i < count; i++)
+  {
+    std::stringstream ss;
+    ss << (i % 3 == 0 ? "1" : "-1");
+    for (const char* ns : {" |a", " |b", " |c"})
+    {
+      ss << ns;
+      for (int j = 0; j < 4; j++) { ss << " f" << index(rng) << ":" << value(rng); }
+    }
+    lines.push_back(ss.str());
+  }
+  return lines;
+}
+
+std::vector<float> train_and_predict(const std::vector<std::string>& args)
+{
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  const auto lines = make_lines(200);
+  for (const auto& line : lines)
+  {
+    auto* ex = VW::read_example(*vw, line);
+    vw->learn(*ex);
+    vw->finish_example(*ex);
+  }
+
+  std::vector<float> predictions;
+  for (const auto& line : make_lines(20))
+  {
+    auto* ex = VW::read_example(*vw, line);
+    vw->predict(*ex);
+    predictions.push_back(ex->pred.scalar);
+    vw->finish_example(*ex);
+  }
+  return predictions;
+}
+}  // namespace
+
+// Plain sgd updates each weight by the sum of its features' gradients, which the factorization machine form computes
+// in one feature, so both forms learn the same model up to float rounding.
+TEST(Lrq, FmFormLearnsLikeDefaultFormWithSgd)
+{
+  const auto expected = train_and_predict({"--quiet", "--sgd", "--lrq", "ab3"});
+  const auto actual = train_and_predict({"--quiet", "--sgd", "--lrq", "ab3", "--lrq_fm"});
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); i++) { EXPECT_NEAR(actual[i], expected[i], 1e-4f) << i; }
+}
+
+TEST(LrqFa, FmFormLearnsLikeDefaultFormWithSgd)
+{
+  const auto expected = train_and_predict({"--quiet", "--sgd", "--lrqfa", "abc2"});
+  const auto actual = train_and_predict({"--quiet", "--sgd", "--lrqfa", "abc2", "--lrqfa_fm"});
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); i++) { EXPECT_NEAR(actual[i], expected[i], 1e-4f) << i; }
+}
+
+// Every namespace is the right side of two field pairs under abc, so each one gets features pushed and removed twice.
+TEST(LrqFa, RestoresExampleAfterLearning)
+{
+  auto vw = VW::initialize(
+      VW::make_unique<VW::config::options_cli>(std::vector<std::string>{"--quiet", "--lrqfa", "abc2"}));
+  auto* ex = VW::read_example(*vw, "1 |a x:0.5 y:1 |b y:2 z:0.25 |c x:1 z:3");
+
+  std::vector<std::vector<uint64_t>> indices;
+  for (unsigned char ns : {'a', 'b', 'c'})
+  {
+    const auto& fs = ex->feature_space[ns];
+    indices.emplace_back(fs.indices.begin(), fs.indices.end());
+  }
+
+  vw->learn(*ex);
+
+  size_t i = 0;
+  for (unsigned char ns : {'a', 'b', 'c'})
+  {
+    const auto& fs = ex->feature_space[ns];
+    EXPECT_EQ(fs.values.size(), indices[i].size()) << ns;
+    EXPECT_EQ(std::vector<uint64_t>(fs.indices.begin(), fs.indices.end()), indices[i]) << ns;
+    i++;
+  }
+  vw->finish_example(*ex);
+}
@@ -0,0 +1,92 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/example.h"
+#include "vw/core/learner.h"
+#include "vw/core/vw.h"
+#include "vw/io/io_adapter.h"
+#include "vw/test_common/test_common.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::string memory_line(int i)
+{
+  return std::to_string(1 + i % 7) + " | a" + std::to_string(i % 13) + ":" + std::to_string(1 + i % 5) + " b" +
+      std::to_string(i % 11) + ":0.5 c" + std::to_string(i);
+}
+
+std::string query_line(int i) { return " | a" + std::to_string(i % 13) + ":2 b" + std::to_string(i % 11) + ":0.5"; }
+
+// With 4 nodes and a multiplier of 200, leaves hold up to 400 memories. Learning 300 memories therefore scans leaves
+// well past two blocks of 64 memories.
+std::unique_ptr<VW::workspace> make_tree(const std::string& scan_threads)
+{
+  return VW::initialize(vwtest::make_args("--quiet", "--memory_tree", "4", "--max_number_of_labels", "7",
+      "--leaf_example_multiplier", "200", "--leaf_scan_threads", scan_threads));
+}
+
+std::vector<uint32_t> learn_memories(VW::workspace& vw)
+{
+  std::vector<uint32_t> predictions;
+  for (int i = 0; i < 300; i++)
+  {
+    auto* ex = VW::read_example(vw, memory_line(i));
+    vw.learn(*ex);
+    predictions.push_back(ex->pred.multiclass);
+    vw.finish_example(*ex);
+  }
+  return predictions;
+}
+
+std::vector<uint32_t> predict_queries(VW::workspace& vw)
+{
+  std::vector<uint32_t> predictions;
+  for (int i = 0; i < 40; i++)
+  {
+    auto* ex = VW::read_example(vw, query_line(i));
+    vw.predict(*ex);
+    predictions.push_back(ex->pred.multiclass);
+    vw.finish_example(*ex);
+  }
+  return predictions;
+}
+}  // namespace
+
+TEST(MemoryTree, ScanThreadsMatchSerial)
+{
+  auto vw_serial = make_tree("0");
+  auto vw_threads = make_tree("3");
+
+  EXPECT_EQ(learn_memories(*vw_serial), learn_memories(*vw_threads));
+  EXPECT_EQ(predict_queries(*vw_serial), predict_queries(*vw_threads));
+}
+
+TEST(MemoryTree, SaveLoadRebuildsFlatMemories)
+{
+  auto vw_save = make_tree("3");
+  learn_memories(*vw_save);
+  // The memories are flattened and cached while learning.
+  const auto expected = predict_queries(*vw_save);
+
+  auto backing_vector = std::make_shared<std::vector<char>>();
+  VW::io_buf io_writer;
+  io_writer.add_file(VW::io::create_vector_writer(backing_vector));
+  VW::save_predictor(*vw_save, io_writer);
+  io_writer.flush();
+
+  // The loaded tree starts without flattened memories and must build them from the loaded examples.
+  for (const char* scan_threads : {"0", "3"})
+  {
+    auto vw_load = VW::initialize(
+        vwtest::make_args("--no_stdin", "--quiet", "--leaf_scan_threads", scan_threads),
+        VW::io::create_buffer_view(backing_vector->data(), backing_vector->size()));
+    EXPECT_EQ(predict_queries(*vw_load), expected) << scan_threads;
+  }
+}
@@ -6,6 +6,7 @@
 
 #include "vw/config/options_cli.h"
 #include "vw/core/reductions/cb/cb_adf.h"
+#include "vw/core/reductions/gd.h"
 #include "vw/core/shared_data.h"
 #include "vw/core/vw.h"
 #include "vw/io/io_adapter.h"
@@ -13,6 +14,10 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <string>
+#include <vector>
+
 TEST(Merge, AddSubtractModelDelta)
 {
   auto vw_base = VW::initialize(vwtest::make_args("--quiet"));
@@ -400,4 +405,322 @@ TEST(Merge, SerializeDeserializeDelta)
       deserialized_delta->unsafe_get_workspace_ptr()->sd->example_number);
   EXPECT_FLOAT_EQ(delta.unsafe_get_workspace_ptr()->sd->total_features,
       deserialized_delta->unsafe_get_workspace_ptr()->sd->total_features);
-}
\ No newline at end of file
+}
+
+namespace
+{
+std::unique_ptr<VW::workspace> train_on(const std::vector<std::string>& args, const std::vector<std::string>& lines)
+{
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  for (const auto& line : lines)
+  {
+    auto* ex = VW::read_example(*vw, line);
+    vw->learn(*ex);
+    vw->finish_example(*ex);
+  }
+  return vw;
+}
+
+std::vector<std::string> wide_examples(int first_feature, int num_examples)
+{
+  std::vector<std::string> lines;
+  for (int i = 0; i < num_examples; i++)
+  {
+    std::string line = (i % 2 == 0) ? "1 |" : "0 |";
+    for (int j = 0; j < 100; j++) { line += " f" + std::to_string(first_feature + i * 100 + j); }
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+std::unique_ptr<VW::model_delta> sparse_round_trip(
+    const VW::model_delta& delta, const VW::model_delta_serialize_options& options, size_t& serialized_size)
+{
+  auto backing_buffer = std::make_shared<std::vector<char>>();
+  {
+    auto writer = VW::io::create_vector_writer(backing_buffer);
+    delta.serialize_sparse(*writer, options);
+  }
+  serialized_size = backing_buffer->size();
+  auto reader = VW::io::create_buffer_view(backing_buffer->data(), backing_buffer->size());
+  return VW::model_delta::deserialize(*reader);
+}
+}  // namespace
+
+TEST(Merge, SerializeSparseDelta)
+{
+  const std::vector<std::string> args{"--quiet"};
+  auto base_lines = wide_examples(0, 10);
+  auto vw_base = train_on(args, base_lines);
+  auto new_lines = base_lines;
+  for (const auto& line : wide_examples(1000, 10)) { new_lines.push_back(line); }
+  auto vw_new = train_on(args, new_lines);
+  auto delta = *vw_new - *vw_base;
+
+  auto full_buffer = std::make_shared<std::vector<char>>();
+  {
+    auto writer = VW::io::create_vector_writer(full_buffer);
+    delta.serialize(*writer);
+  }
+
+  for (auto encoding : {VW::model_delta_value_encoding::FLOAT32, VW::model_delta_value_encoding::FLOAT16,
+           VW::model_delta_value_encoding::INT8})
+  {
+    size_t uncompressed_size = 0;
+    for (bool compress : {false, true})
+    {
+      VW::model_delta_serialize_options options;
+      options.value_encoding = encoding;
+      options.compress = compress;
+      size_t serialized_size = 0;
+      auto deserialized_delta = sparse_round_trip(delta, options, serialized_size);
+      // The full format drops learner scratch slots, so only the narrower encodings are guaranteed to beat it.
+      if (encoding != VW::model_delta_value_encoding::FLOAT32) { EXPECT_LT(serialized_size, full_buffer->size()); }
+      if (compress) { EXPECT_LT(serialized_size, uncompressed_size); }
+      else { uncompressed_size = serialized_size; }
+
+      auto& expected = delta.unsafe_get_workspace_ptr()->weights.dense_weights;
+      auto& actual = deserialized_delta->unsafe_get_workspace_ptr()->weights.dense_weights;
+      // Each slot is quantized on its own, so a large adaptive sum does not cost the weights their precision.
+      const auto stride = delta.unsafe_get_workspace_ptr()->weights.stride();
+      std::vector<float> max_abs(stride, 0.f);
+      for (size_t i = 0; i <= expected.mask(); i++)
+      {
+        max_abs[i % stride] = std::max(max_abs[i % stride], std::fabs(expected[i]));
+      }
+      for (size_t i = 0; i <= expected.mask(); i++)
+      {
+        float tolerance = 0.f;
+        if (encoding == VW::model_delta_value_encoding::FLOAT16) { tolerance = max_abs[i % stride] / 1000.f; }
+        else if (encoding == VW::model_delta_value_encoding::INT8) { tolerance = max_abs[i % stride] / 127.f; }
+        EXPECT_NEAR(expected[i], actual[i], tolerance);
+      }
+
+      EXPECT_FLOAT_EQ(delta.unsafe_get_workspace_ptr()->sd->weighted_labeled_examples,
+          deserialized_delta->unsafe_get_workspace_ptr()->sd->weighted_labeled_examples);
+      EXPECT_FLOAT_EQ(
+          delta.unsafe_get_workspace_ptr()->sd->sum_loss, deserialized_delta->unsafe_get_workspace_ptr()->sd->sum_loss);
+    }
+  }
+
+  // Serializing must leave the delta itself untouched, so adding it back still reproduces the new model.
+  size_t serialized_size = 0;
+  auto deserialized_delta = sparse_round_trip(delta, VW::model_delta_serialize_options{}, serialized_size);
+  auto base_plus_delta = *vw_base + delta;
+  auto base_plus_deserialized = *vw_base + *deserialized_delta;
+  auto& expected = base_plus_delta->weights.dense_weights;
+  auto& actual = base_plus_deserialized->weights.dense_weights;
+  auto& original = vw_new->weights.dense_weights;
+  for (size_t i = 0; i <= expected.mask(); i++)
+  {
+    EXPECT_FLOAT_EQ(expected[i], actual[i]);
+    EXPECT_NEAR(original[i], actual[i], 1e-5f);
+  }
+}
+
+TEST(Merge, SerializeSparseDeltaMergesAsFullDelta)
+{
+  const std::vector<std::string> args{"--quiet"};
+  auto vw_base = train_on(args, {"1 | a b"});
+  auto vw1 = train_on(args, {"1 | a b", "0 | c"});
+  auto vw2 = train_on(args, {"1 | a b", "1 | d e"});
+
+  auto delta1 = *vw1 - *vw_base;
+  auto delta2 = *vw2 - *vw_base;
+  size_t serialized_size = 0;
+  auto sparse_delta1 = sparse_round_trip(delta1, VW::model_delta_serialize_options{}, serialized_size);
+  auto sparse_delta2 = sparse_round_trip(delta2, VW::model_delta_serialize_options{}, serialized_size);
+
+  auto merged = VW::merge_deltas(std::vector<const VW::model_delta*>{&delta1, &delta2});
+  auto sparse_merged = VW::merge_deltas(std::vector<const VW::model_delta*>{sparse_delta1.get(), sparse_delta2.get()});
+  auto expected = *vw_base + merged;
+  auto actual = *vw_base + sparse_merged;
+
+  EXPECT_FLOAT_EQ(expected->sd->weighted_labeled_examples, actual->sd->weighted_labeled_examples);
+  for (const auto* feature : {"a", "b", "c", "d", "e"})
+  {
+    auto* expected_ex = VW::read_example(*expected, std::string("| ") + feature);
+    expected->predict(*expected_ex);
+    auto* actual_ex = VW::read_example(*actual, std::string("| ") + feature);
+    actual->predict(*actual_ex);
+    EXPECT_FLOAT_EQ(expected_ex->pred.scalar, actual_ex->pred.scalar);
+    expected->finish_example(*expected_ex);
+    actual->finish_example(*actual_ex);
+  }
+}
+
+TEST(Merge, SerializeSparseDeltaPredictOnlyShipsWeightsOnly)
+{
+  VW::model_delta full_delta(train_on({"--quiet"}, wide_examples(0, 4)));
+  VW::model_delta delta(train_on({"--quiet", "--predict_only_model"}, wide_examples(0, 4)));
+  size_t full_size = 0;
+  sparse_round_trip(full_delta, VW::model_delta_serialize_options{}, full_size);
+  size_t serialized_size = 0;
+  auto deserialized_delta = sparse_round_trip(delta, VW::model_delta_serialize_options{}, serialized_size);
+  EXPECT_LT(serialized_size, full_size);
+
+  auto& expected = delta.unsafe_get_workspace_ptr()->weights.dense_weights;
+  auto& actual = deserialized_delta->unsafe_get_workspace_ptr()->weights.dense_weights;
+  const auto stride = delta.unsafe_get_workspace_ptr()->weights.stride();
+  for (size_t i = 0; i <= expected.mask(); i++)
+  {
+    if (i % stride == 0) { EXPECT_FLOAT_EQ(expected[i], actual[i]); }
+    else { EXPECT_FLOAT_EQ(actual[i], 0.f); }
+  }
+}
+
+TEST(Merge, SerializeSparseDeltaSparseWeights)
+{
+  VW::model_delta delta(train_on({"--quiet", "--sparse_weights"}, wide_examples(0, 4)));
+  size_t serialized_size = 0;
+  auto deserialized_delta = sparse_round_trip(delta, VW::model_delta_serialize_options{}, serialized_size);
+
+  auto* expected = delta.unsafe_get_workspace_ptr();
+  auto* actual = deserialized_delta->unsafe_get_workspace_ptr();
+  for (const auto& line : wide_examples(0, 4))
+  {
+    auto* expected_ex = VW::read_example(*expected, line);
+    expected->predict(*expected_ex);
+    auto* actual_ex = VW::read_example(*actual, line);
+    actual->predict(*actual_ex);
+    EXPECT_FLOAT_EQ(expected_ex->pred.scalar, actual_ex->pred.scalar);
+    expected->finish_example(*expected_ex);
+    actual->finish_example(*actual_ex);
+  }
+}
+
+TEST(Merge, MergeModelsStreaming)
+{
+  for (const auto& args : std::vector<std::vector<std::string>>{{"--quiet"}, {"--quiet", "--sgd"}})
+  {
+    std::vector<std::unique_ptr<VW::workspace>> models;
+    for (int i = 0; i < 4; i++) { models.push_back(train_on(args, wide_examples(i * 150, 3 + i))); }
+    auto base = train_on(args, wide_examples(0, 2));
+    std::vector<const VW::workspace*> model_ptrs;
+    for (const auto& model : models) { model_ptrs.push_back(model.get()); }
+
+    for (const auto* base_ptr : std::vector<const VW::workspace*>{nullptr, base.get()})
+    {
+      auto expected = VW::merge_models(base_ptr, model_ptrs);
+      for (size_t num_threads : {size_t{0}, size_t{3}})
+      {
+        auto actual = VW::merge_models_streaming(
+            base_ptr, models.size(), [&model_ptrs](size_t i) { return VW::clone_workspace(*model_ptrs[i]); },
+            num_threads);
+
+        EXPECT_FLOAT_EQ(expected->sd->weighted_labeled_examples, actual->sd->weighted_labeled_examples);
+        EXPECT_FLOAT_EQ(expected->sd->sum_loss, actual->sd->sum_loss);
+        auto& expected_weights = expected->weights.dense_weights;
+        auto& actual_weights = actual->weights.dense_weights;
+        ASSERT_EQ(expected_weights.mask(), actual_weights.mask());
+        for (size_t i = 0; i <= expected_weights.mask(); i++)
+        {
+          EXPECT_NEAR(expected_weights[i], actual_weights[i], 1e-5f + 1e-4f * std::fabs(expected_weights[i]));
+        }
+      }
+    }
+  }
+}
+
+TEST(Merge, MergeModelsStreamingSparseWeights)
+{
+  const std::vector<std::string> args = {"--quiet", "--sgd", "--sparse_weights", "-b", "14"};
+  auto load_model = [&args](size_t i) { return train_on(args, wide_examples(static_cast<int>(i) * 150, 3 + i)); };
+  std::vector<std::unique_ptr<VW::workspace>> models;
+  for (size_t i = 0; i < 3; i++) { models.push_back(load_model(i)); }
+
+  for (size_t num_threads : {size_t{0}, size_t{3}})
+  {
+    auto actual = VW::merge_models_streaming(nullptr, models.size(), load_model, num_threads);
+
+    // Without adaptive slots the weights are averaged by example count.
+    float total_count = 0.f;
+    for (const auto& model : models) { total_count += model->sd->weighted_labeled_examples; }
+    EXPECT_FLOAT_EQ(actual->sd->weighted_labeled_examples, total_count);
+    const size_t length = static_cast<size_t>(1) << actual->initial_weights_config.num_bits;
+    for (size_t i = 0; i < length; i++)
+    {
+      float expected = 0.f;
+      for (const auto& model : models)
+      {
+        expected += model->weights.sparse_weights.strided_index(i) * model->sd->weighted_labeled_examples / total_count;
+      }
+      EXPECT_NEAR(expected, actual->weights.sparse_weights.strided_index(i), 1e-6f + 1e-5f * std::fabs(expected));
+    }
+  }
+}
+
+TEST(Merge, MergeModelsStreamingCbModel)
+{
+  std::vector<std::unique_ptr<VW::workspace>> models;
+  for (int i = 0; i < 3; i++)
+  {
+    auto vw = VW::initialize(vwtest::make_args("--quiet", "--cb_explore_adf"));
+    for (int j = 0; j < 2 + i; j++)
+    {
+      VW::multi_ex examples;
+      examples.push_back(VW::read_example(*vw, "shared |User user=u" + std::to_string(i * 10 + j)));
+      for (int a = 0; a < 4; a++)
+      {
+        const std::string label = a == (i + j) % 4 ? "0:" + std::to_string(a * 0.5f) + ":0.25 " : "";
+        examples.push_back(VW::read_example(*vw, label + "|Action article=a" + std::to_string(a)));
+      }
+      VW::setup_examples(*vw, examples);
+      vw->learn(examples);
+      vw->finish_example(examples);
+    }
+    models.push_back(std::move(vw));
+  }
+  std::vector<const VW::workspace*> model_ptrs;
+  for (const auto& model : models) { model_ptrs.push_back(model.get()); }
+
+  auto expected = VW::merge_models(nullptr, model_ptrs);
+  auto actual = VW::merge_models_streaming(
+      nullptr, models.size(), [&model_ptrs](size_t i) { return VW::clone_workspace(*model_ptrs[i]); });
+
+  auto cb_adf_of = [](VW::workspace& vw)
+  {
+    return reinterpret_cast<VW::reductions::cb_adf*>(
+        vw.l->get_learner_by_name_prefix("cb_adf")->get_internal_type_erased_data_pointer_test_use_only());
+  };
+  auto& expected_states = cb_adf_of(*expected)->get_gen_cs_mtr().per_model_state;
+  auto& actual_states = cb_adf_of(*actual)->get_gen_cs_mtr().per_model_state;
+  ASSERT_EQ(expected_states.size(), actual_states.size());
+  for (size_t i = 0; i < expected_states.size(); i++)
+  {
+    EXPECT_EQ(expected_states[i].event_sum, actual_states[i].event_sum);
+    EXPECT_EQ(expected_states[i].action_sum, actual_states[i].action_sum);
+  }
+
+  auto gd_of = [](VW::workspace& vw)
+  {
+    return reinterpret_cast<VW::reductions::gd*>(
+        vw.l->get_learner_by_name_prefix("gd")->get_internal_type_erased_data_pointer_test_use_only());
+  };
+  auto& expected_gd = gd_of(*expected)->gd_per_model_states;
+  auto& actual_gd = gd_of(*actual)->gd_per_model_states;
+  ASSERT_EQ(expected_gd.size(), actual_gd.size());
+  for (size_t i = 0; i < expected_gd.size(); i++)
+  {
+    EXPECT_DOUBLE_EQ(expected_gd[i].normalized_sum_norm_x, actual_gd[i].normalized_sum_norm_x);
+    EXPECT_DOUBLE_EQ(expected_gd[i].total_weight, actual_gd[i].total_weight);
+  }
+
+  EXPECT_FLOAT_EQ(expected->sd->weighted_labeled_examples, actual->sd->weighted_labeled_examples);
+  auto& expected_weights = expected->weights.dense_weights;
+  auto& actual_weights = actual->weights.dense_weights;
+  for (size_t i = 0; i <= expected_weights.mask(); i++)
+  {
+    EXPECT_NEAR(expected_weights[i], actual_weights[i], 1e-5f + 1e-4f * std::fabs(expected_weights[i]));
+  }
+}
+
+TEST(Merge, MergeModelsStreamingRejectsDifferentModels)
+{
+  auto first = train_on({"--quiet"}, wide_examples(0, 2));
+  auto second = train_on({"--quiet", "--sgd"}, wide_examples(0, 2));
+  std::vector<const VW::workspace*> model_ptrs{first.get(), second.get()};
+  EXPECT_THROW(VW::merge_models_streaming(nullptr, model_ptrs.size(),
+                   [&model_ptrs](size_t i) { return VW::clone_workspace(*model_ptrs[i]); }),
+      VW::vw_exception);
+}
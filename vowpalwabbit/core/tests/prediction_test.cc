@@ -2,12 +2,20 @@
 // individual contributors. All rights reserved. Released under a BSD (revised)
 // license as described in the file LICENSE.
 
+#include "vw/config/options_cli.h"
+#include "vw/core/learner.h"
 #include "vw/core/vw.h"
+#include "vw/io/io_adapter.h"
 #include "vw/test_common/test_common.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
 // Test case validating this issue: https://github.com/VowpalWabbit/vowpal_wabbit/issues/2166
 TEST(Predict, PredictModifyingState)
 {
@@ -43,3 +51,160 @@ TEST(Predict, PredictModifyingState)
 
   EXPECT_FLOAT_EQ(prediction_one, prediction_two);
 }
+
+// The dense multipredict kernel must produce the same class scores as the scalar path used for sparse weights.
+TEST(Predict, DenseMultipredictMatchesSparse)
+{
+  const std::vector<std::vector<std::string>> configs = {
+      {"--sgd"}, {"--adaptive"}, {"--normalized"}, {}, {"-b", "6"}, {"--bag", "2"}};
+  for (const auto& config : configs)
+  {
+    for (int k : {3, 17})
+    {
+      std::vector<std::string> args = {"--quiet", "--oaa", std::to_string(k), "--probabilities", "--noconstant"};
+      args.insert(args.end(), config.begin(), config.end());
+      auto sparse_args = args;
+      sparse_args.push_back("--sparse_weights");
+      auto dense = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+      auto sparse = VW::initialize(VW::make_unique<VW::config::options_cli>(sparse_args));
+
+      for (int i = 0; i < 50; i++)
+      {
+        const auto line = std::to_string(i % k + 1) + " |a x" + std::to_string(i % 7) + ":0.5 y" +
+            std::to_string(i % 5) + " |b z" + std::to_string(i % 3) + ":2";
+        for (auto* vw : {dense.get(), sparse.get()})
+        {
+          auto* ex = VW::read_example(*vw, line);
+          vw->learn(*ex);
+          vw->finish_example(*ex);
+        }
+      }
+
+      auto* dense_ex = VW::read_example(*dense, "|a x1:0.5 y3 |b z2:2");
+      auto* sparse_ex = VW::read_example(*sparse, "|a x1:0.5 y3 |b z2:2");
+      dense->predict(*dense_ex);
+      sparse->predict(*sparse_ex);
+      ASSERT_EQ(dense_ex->pred.scalars.size(), static_cast<size_t>(k));
+      ASSERT_EQ(sparse_ex->pred.scalars.size(), static_cast<size_t>(k));
+      for (int c = 0; c < k; c++) { EXPECT_FLOAT_EQ(dense_ex->pred.scalars[c], sparse_ex->pred.scalars[c]); }
+      dense->finish_example(*dense_ex);
+      sparse->finish_example(*sparse_ex);
+    }
+  }
+}
+
+TEST(Predict, MultilineMultipredictMatchesPredict)
+{
+  // The fused path is used for ips and mtr; dr uses two weight vectors per policy and goes through the fallback.
+  for (const char* cb_type : {"ips", "mtr", "dr"})
+  {
+    auto vw = VW::initialize(
+        vwtest::make_args("--quiet", "--cb_explore_adf", "--bag", "3", "--cb_type", cb_type, "-q", "::"));
+    auto read_actions = [&vw](const std::vector<std::string>& lines)
+    {
+      VW::multi_ex examples;
+      for (const auto& line : lines) { examples.push_back(VW::read_example(*vw, line)); }
+      return examples;
+    };
+
+    for (int i = 0; i < 30; i++)
+    {
+      const auto chosen = std::to_string(i % 3);
+      auto examples = read_actions({(i % 3 == 0 ? "0:1.0:0.5 " : "") + std::string("|a x") + chosen + " y:0.5",
+          (i % 3 == 1 ? "0:0.0:0.5 " : "") + std::string("|a x1 z:2"),
+          (i % 3 == 2 ? "0:0.5:0.5 " : "") + std::string("|a x2 y:") + chosen});
+      vw->learn(examples);
+      vw->finish_example(examples);
+    }
+
+    auto* cb_adf = vw->l->get_learner_by_name_prefix("cb_adf");
+    auto examples = read_actions({"|a x0 y:0.5", "|a x1 z:2", "|a x2 y:1"});
+    std::vector<VW::polyprediction> preds(3);
+    cb_adf->multipredict(examples, 0, preds.size(), preds.data(), false);
+
+    for (size_t i = 0; i < preds.size(); i++)
+    {
+      cb_adf->predict(examples, i);
+      const auto& expected = examples[0]->pred.a_s;
+      ASSERT_EQ(preds[i].a_s.size(), expected.size());
+      for (size_t j = 0; j < expected.size(); j++)
+      {
+        EXPECT_EQ(preds[i].a_s[j].action, expected[j].action);
+        EXPECT_FLOAT_EQ(preds[i].a_s[j].score, expected[j].score);
+      }
+    }
+    vw->finish_example(examples);
+  }
+}
+
+TEST(Predict, CsoaaLdfMultipredictReportsRawScores)
+{
+  // Only the identity link is fused; with another link the ranking must still hold the raw scores, as predict does.
+  for (const char* link : {"identity", "logistic"})
+  {
+    auto vw = VW::initialize(vwtest::make_args("--quiet", "--csoaa_ldf", "m", "--csoaa_rank", "--link", link));
+    auto read_actions = [&vw](const std::vector<std::string>& lines)
+    {
+      VW::multi_ex examples;
+      for (const auto& line : lines) { examples.push_back(VW::read_example(*vw, line)); }
+      return examples;
+    };
+
+    for (int i = 0; i < 30; i++)
+    {
+      auto examples = read_actions({"1:" + std::to_string(i % 3 == 0 ? 0.f : 1.f) + " |a x0 y:0.5",
+          "2:" + std::to_string(i % 3 == 1 ? 0.f : 1.f) + " |a x1 z:2", "3:0.5 |a x2 y:1"});
+      vw->learn(examples);
+      vw->finish_example(examples);
+    }
+
+    auto* csoaa_ldf = vw->l->get_learner_by_name_prefix("csoaa_ldf");
+    auto examples = read_actions({"1:0 |a x0 y:0.5", "2:0 |a x1 z:2", "3:0 |a x2 y:1"});
+    for (auto* ec : examples) { ec->l.cs.costs[0].partial_prediction = -1.f; }
+    std::vector<VW::polyprediction> preds(2);
+    csoaa_ldf->multipredict(examples, 0, preds.size(), preds.data(), false);
+    for (auto* ec : examples) { EXPECT_FLOAT_EQ(ec->l.cs.costs[0].partial_prediction, -1.f) << link; }
+
+    for (size_t i = 0; i < preds.size(); i++)
+    {
+      csoaa_ldf->predict(examples, i);
+      const auto& expected = examples[0]->pred.a_s;
+      ASSERT_EQ(preds[i].a_s.size(), expected.size());
+      for (size_t j = 0; j < expected.size(); j++)
+      {
+        EXPECT_EQ(preds[i].a_s[j].action, expected[j].action) << link;
+        EXPECT_FLOAT_EQ(preds[i].a_s[j].score, expected[j].score) << link;
+      }
+    }
+    vw->finish_example(examples);
+  }
+}
+
+TEST(Predict, BinaryPredictionsFormatRoundTrips)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "--predictions_format", "binary"));
+  auto backing_vector = std::make_shared<std::vector<char>>();
+  vw->output_runtime.final_prediction_sink.push_back(VW::io::create_vector_writer(backing_vector));
+
+  const std::vector<std::string> lines = {"1 'first |f a b", "0 |f a c", "1 'third |f b:0.5 c", "-2 |f d"};
+  std::vector<float> expected;
+  for (const auto& line : lines)
+  {
+    auto* ex = VW::read_example(*vw, line);
+    vw->learn(*ex);
+    expected.push_back(ex->pred.scalar);
+    vw->finish_example(*ex);
+  }
+
+  // One native float per example, without tags or separators.
+  ASSERT_EQ(backing_vector->size(), expected.size() * sizeof(float));
+  for (size_t i = 0; i < expected.size(); i++)
+  {
+    float actual = 0.f;
+    std::memcpy(&actual, backing_vector->data() + i * sizeof(float), sizeof(float));
+    EXPECT_EQ(actual, expected[i]);
+  }
+
+  EXPECT_THROW(VW::initialize(vwtest::make_args("--quiet", "--oaa", "3", "--predictions_format", "binary")),
+      VW::vw_exception);
+}
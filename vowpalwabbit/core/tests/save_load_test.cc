@@ -2,6 +2,7 @@
 // individual contributors. All rights reserved. Released under a BSD (revised)
 // license as described in the file LICENSE.
 
+#include "vw/common/vw_exception.h"
 #include "vw/config/options_cli.h"
 #include "vw/core/shared_data.h"
 #include "vw/core/vw.h"
@@ -16,6 +17,7 @@
 using namespace ::testing;
 
 #include <string>
+#include <vector>
 
 TEST(SaveLoad, SaveResumeBehavesAsIfDatasetConcatenated)
 {
@@ -85,3 +87,110 @@ TEST(SaveLoad, SaveResumeBehavesAsIfDatasetConcatenated)
   EXPECT_EQ(vw_all_data_single_run->sd->weighted_examples(), vw_second_half_from_loaded->sd->weighted_examples());
   EXPECT_EQ(vw_all_data_single_run->sd->sum_loss, vw_second_half_from_loaded->sd->sum_loss);
 }
+
+namespace
+{
+void learn_line(VW::workspace& vw, const std::string& line)
+{
+  auto* ex = VW::read_example(vw, line);
+  vw.learn(*ex);
+  vw.finish_example(*ex);
+}
+
+float predict_line(VW::workspace& vw, const std::string& line)
+{
+  auto* ex = VW::read_example(vw, line);
+  vw.predict(*ex);
+  const float prediction = ex->pred.scalar;
+  vw.finish_example(*ex);
+  return prediction;
+}
+}  // namespace
+
+TEST(SaveLoad, CloneWorkspace)
+{
+  const std::vector<std::string> lines = {"1 |a x y |b z", "0 |a x |b w", "1 |a y |b z w", "0 |a q |b r",
+      "1 |a x q |b r z", "0 |a y |b w"};
+  const std::vector<std::vector<std::string>> configurations = {{"--quiet"}, {"--quiet", "--sparse_weights"},
+      {"--quiet", "-b", "20", "--interactions", "ab"}, {"--quiet", "--coin"}};
+
+  for (const auto& args : configurations)
+  {
+    auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+    for (size_t i = 0; i < 3; i++) { learn_line(*vw, lines[i]); }
+
+    auto clone = VW::clone_workspace(*vw);
+    EXPECT_EQ(vw->sd->weighted_labeled_examples, clone->sd->weighted_labeled_examples);
+    EXPECT_EQ(vw->sd->sum_loss, clone->sd->sum_loss);
+    for (const auto& line : lines) { EXPECT_FLOAT_EQ(predict_line(*vw, line), predict_line(*clone, line)); }
+
+    // Both continue learning as if the model had been saved and loaded.
+    for (size_t i = 3; i < lines.size(); i++)
+    {
+      learn_line(*vw, lines[i]);
+      learn_line(*clone, lines[i]);
+    }
+    for (const auto& line : lines) { EXPECT_FLOAT_EQ(predict_line(*vw, line), predict_line(*clone, line)); }
+    EXPECT_EQ(vw->sd->sum_loss, clone->sd->sum_loss);
+
+    // Learning on the clone leaves the original untouched.
+    const float before = predict_line(*vw, lines[1]);
+    for (size_t i = 0; i < 10; i++) { learn_line(*clone, "1 |a x |b w"); }
+    EXPECT_FLOAT_EQ(before, predict_line(*vw, lines[1]));
+    EXPECT_NE(before, predict_line(*clone, lines[1]));
+  }
+}
+
+TEST(SaveLoad, HashAlgorithmIsStoredInModel)
+{
+  auto vw = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "--hash_algorithm", "wyhash"));
+  for (size_t i = 0; i < 5; i++) { learn_line(*vw, "1 |f alpha beta:2"); }
+
+  auto backing_vector = std::make_shared<std::vector<char>>();
+  VW::io_buf io_writer;
+  io_writer.add_file(VW::io::create_vector_writer(backing_vector));
+  VW::save_predictor(*vw, io_writer);
+  io_writer.flush();
+
+  // The loaded model picks up wyhash without being told.
+  auto loaded = VW::initialize(vwtest::make_args("--no_stdin", "--quiet"),
+      VW::io::create_buffer_view(backing_vector->data(), backing_vector->size()));
+  EXPECT_EQ(loaded->options->get_typed_option<std::string>("hash_algorithm").value(), "wyhash");
+
+  auto* ex = VW::read_example(*loaded, "|f alpha");
+  const uint64_t ns_hash = VW::details::hashstring_wyhash("f", 1, 0);
+  const uint64_t feature_hash =
+      VW::details::hashstring_wyhash("alpha", 5, static_cast<uint32_t>(ns_hash)) & loaded->runtime_state.parse_mask;
+  EXPECT_EQ(ex->feature_space['f'].indices[0], feature_hash << loaded->weights.stride_shift());
+  loaded->finish_example(*ex);
+
+  EXPECT_FLOAT_EQ(predict_line(*vw, "|f alpha beta:2"), predict_line(*loaded, "|f alpha beta:2"));
+
+  auto murmur = VW::initialize(vwtest::make_args("--no_stdin", "--quiet"));
+  EXPECT_NE(VW::hash_space(*murmur, "f"), VW::hash_space(*loaded, "f"));
+  EXPECT_EQ(VW::hash_space_static("f", "strings", "wyhash"), VW::hash_space(*loaded, "f"));
+  EXPECT_EQ(VW::hash_space_static("f", "strings"), VW::hash_space(*murmur, "f"));
+  EXPECT_EQ(
+      VW::hash_feature_static("alpha", ns_hash, "strings", 18, "wyhash"), VW::hash_feature(*loaded, "alpha", ns_hash));
+}
+
+TEST(SaveLoad, DefaultHashModelRejectsOtherHashAlgorithm)
+{
+  auto vw = VW::initialize(vwtest::make_args("--no_stdin", "--quiet"));
+  for (size_t i = 0; i < 5; i++) { learn_line(*vw, "1 |f alpha beta:2"); }
+
+  auto backing_vector = std::make_shared<std::vector<char>>();
+  VW::io_buf io_writer;
+  io_writer.add_file(VW::io::create_vector_writer(backing_vector));
+  VW::save_predictor(*vw, io_writer);
+  io_writer.flush();
+
+  // The model does not name its hash, which means murmur3.
+  EXPECT_THROW(VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "--hash_algorithm", "wyhash"),
+                   VW::io::create_buffer_view(backing_vector->data(), backing_vector->size())),
+      VW::vw_argument_disagreement_exception);
+
+  auto loaded = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "--hash_algorithm", "murmur3"),
+      VW::io::create_buffer_view(backing_vector->data(), backing_vector->size()));
+  EXPECT_FLOAT_EQ(predict_line(*vw, "|f alpha beta:2"), predict_line(*loaded, "|f alpha beta:2"));
+}
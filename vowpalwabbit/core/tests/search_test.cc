@@ -0,0 +1,113 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/config/options_cli.h"
+#include "vw/core/example.h"
+#include "vw/core/learner.h"
+#include "vw/core/metric_sink.h"
+#include "vw/core/shared_data.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Sequences of 12 tokens labeled 1-4. A token's label follows from its word, so there is something to learn.
+std::vector<std::vector<std::string>> make_sequences(size_t count)
+{
+  std::mt19937 rng(21);
+  std::uniform_int_distribution<int> word(0, 15);
+
+  std::vector<std::vector<std::string>> sequences;
+  for (size_t i = 0; i < count; i++)
+  {
+    std::vector<std::string> lines;
+    for (int t = 0; t < 12; t++)
+    {
+      const int w = word(rng);
+      lines.push_back(std::to_string(w % 4 + 1) + " | w" + std::to_string(w));
+    }
+    sequences.push_back(lines);
+  }
+  return sequences;
+}
+
+std::unique_ptr<VW::workspace> train(const std::vector<std::string>& extra_args)
+{
+  std::vector<std::string> args = {"--quiet", "--search", "4", "--search_task", "sequence", "--search_rollout",
+      "learn", "--search_rollin", "learn", "--extra_metrics", "unused.json"};
+  args.insert(args.end(), extra_args.begin(), extra_args.end());
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+
+  for (const auto& lines : make_sequences(30))
+  {
+    VW::multi_ex seq;
+    for (const auto& line : lines) { seq.push_back(VW::read_example(*vw, line)); }
+    vw->learn(seq);
+    vw->finish_example(seq);
+  }
+  return vw;
+}
+
+std::vector<float> weights_of(VW::workspace& vw)
+{
+  std::vector<float> weights;
+  for (auto it = vw.weights.dense_weights.begin(); it != vw.weights.dense_weights.end(); ++it)
+  {
+    weights.push_back(*it);
+  }
+  return weights;
+}
+
+VW::metric_sink metrics_of(VW::workspace& vw) { return vw.output_runtime.global_metrics.collect_metrics(vw.l.get()); }
+}  // namespace
+
+TEST(SearchCache, ReportsHitsAndMisses)
+{
+  auto vw = train({});
+  auto metrics = metrics_of(*vw);
+  EXPECT_GT(metrics.get_uint("search_cache_hits"), 0);
+  EXPECT_GT(metrics.get_uint("search_cache_misses"), 0);
+  EXPECT_EQ(metrics.get_uint("search_cache_evictions"), 0);
+
+  auto uncached = train({"--search_no_caching"});
+  auto uncached_metrics = metrics_of(*uncached);
+  EXPECT_EQ(uncached_metrics.get_uint("search_cache_hits"), 0);
+  EXPECT_EQ(uncached_metrics.get_uint("search_cache_misses"), 0);
+
+  // A hit returns what the policy would have predicted, so caching does not change what is learned.
+  EXPECT_EQ(weights_of(*vw), weights_of(*uncached));
+  EXPECT_DOUBLE_EQ(vw->sd->sum_loss, uncached->sd->sum_loss);
+}
+
+TEST(SearchCache, EvictsAtCacheSize)
+{
+  auto unbounded = train({"--search_cache_size", "0"});
+  auto bounded = train({"--search_cache_size", "4"});
+
+  auto unbounded_metrics = metrics_of(*unbounded);
+  auto bounded_metrics = metrics_of(*bounded);
+  EXPECT_EQ(unbounded_metrics.get_uint("search_cache_evictions"), 0);
+  EXPECT_GT(bounded_metrics.get_uint("search_cache_evictions"), 0);
+  // Evicted entries are predicted again, so the bounded cache misses more but learns the same.
+  EXPECT_GT(bounded_metrics.get_uint("search_cache_misses"), unbounded_metrics.get_uint("search_cache_misses"));
+  EXPECT_EQ(weights_of(*bounded), weights_of(*unbounded));
+}
+
+TEST(SearchCache, KeysCrossValidationLearnersApart)
+{
+  // Under --search_xv a policy's predictions come from one of two learners, picked per example and per state.
+  auto cached = train({"--search_xv"});
+  auto uncached = train({"--search_xv", "--search_no_caching"});
+
+  EXPECT_GT(metrics_of(*cached).get_uint("search_cache_hits"), 0);
+  EXPECT_EQ(weights_of(*cached), weights_of(*uncached));
+  EXPECT_DOUBLE_EQ(cached->sd->sum_loss, uncached->sd->sum_loss);
+}
@@ -0,0 +1,98 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/shared_interaction_cache.h"
+
+#include "vw/core/example.h"
+#include "vw/core/interactions_predict.h"
+#include "vw/core/reductions/gd.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using generated_terms = std::vector<std::pair<uint64_t, float>>;
+
+void record_term(generated_terms& terms, float value, uint64_t index) { terms.emplace_back(index, value); }
+
+generated_terms expand(VW::workspace& all, VW::example& ec, size_t& num_features)
+{
+  generated_terms terms;
+  VW::generate_interactions<generated_terms, uint64_t, record_term, false, nullptr>(all, ec, terms, num_features);
+  return terms;
+}
+}  // namespace
+
+TEST(SharedInteractionCache, ReplayMatchesExpansion)
+{
+  for (const std::string permutations : {"--noconstant", "--permutations"})
+  {
+    auto vw = VW::initialize(vwtest::make_args("--quiet", permutations, "-q", "ss", "-q", "sa", "--cubic", "sss",
+        "--interactions", "ssss", "--interactions", "sssa", "--interactions", "sssss"));
+    auto* shared = VW::read_example(*vw, "|s a b:2 c d:0.5 e");
+    // The last action has features of its own in the shared namespace, so it must not be served from the cache.
+    const std::vector<std::string> action_lines = {"|a x y", "|a z", "|a x |s f:3"};
+
+    VW::details::shared_interaction_cache cache;
+    cache.reset(shared);
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+      uint64_t ft_offset = 0;
+      for (const auto& line : action_lines)
+      {
+        auto* action = VW::read_example(*vw, line);
+        VW::details::append_example_namespaces_from_example(*action, *shared);
+        action->ft_offset = ft_offset;
+        ft_offset += 2;
+
+        size_t expected_count = 0;
+        const auto expected = expand(*vw, *action, expected_count);
+
+        action->shared_interactions = &cache;
+        size_t count = 0;
+        const auto actual = expand(*vw, *action, count);
+        action->shared_interactions = nullptr;
+
+        EXPECT_THAT(actual, ::testing::ElementsAreArray(expected));
+        EXPECT_EQ(count, expected_count);
+
+        VW::details::truncate_example_namespaces_from_example(*action, *shared);
+        vw->finish_example(*action);
+      }
+    }
+    // Only the interactions of four or more shared namespaces are looked up and stored.
+    EXPECT_EQ(cache.size(), 2u);
+
+    cache.reset(nullptr);
+    EXPECT_EQ(cache.size(), 0u);
+    vw->finish_example(*shared);
+  }
+}
+
+TEST(SharedInteractionCache, NotUsedWithoutSharedFeatures)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "-q", "ss"));
+  auto* shared = VW::read_example(*vw, "|t a b");
+  auto* action = VW::read_example(*vw, "|s x y");
+  VW::details::append_example_namespaces_from_example(*action, *shared);
+
+  VW::details::shared_interaction_cache cache;
+  cache.reset(shared);
+  EXPECT_EQ(cache.find({'s', 's'}, false, action->feature_space), nullptr);
+  EXPECT_EQ(cache.find({'t', 't'}, false, action->feature_space)->size(), 3u);
+  EXPECT_EQ(cache.find({'t', 't'}, true, action->feature_space)->size(), 4u);
+  EXPECT_EQ(cache.size(), 2u);
+
+  VW::details::truncate_example_namespaces_from_example(*action, *shared);
+  vw->finish_example(*action);
+  vw->finish_example(*shared);
+}
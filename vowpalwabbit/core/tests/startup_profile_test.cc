@@ -0,0 +1,64 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/startup_profile.h"
+
+#include "vw/common/random_details.h"
+#include "vw/core/global_data.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+std::vector<std::string> names(const std::vector<VW::details::startup_profile::entry>& entries)
+{
+  std::vector<std::string> result;
+  for (const auto& e : entries) { result.push_back(e.name); }
+  return result;
+}
+}  // namespace
+
+TEST(StartupProfile, RecordsPhasesAndReductions)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "--oaa", "3", "--normal_weights", "-b", "22"));
+  const auto& profile = vw->runtime_state.startup_profile;
+
+  EXPECT_THAT(names(profile.phases),
+      testing::ElementsAre("parse_args", "open_model_files", "load_model_header", "parse_modules", "setup_reductions",
+          "load_model", "enable_sources", "load_dictionaries"));
+  for (const auto& phase : profile.phases) { EXPECT_GE(phase.seconds, 0.0) << phase.name; }
+
+  const auto reductions = names(profile.reductions);
+  EXPECT_THAT(reductions, testing::Contains("oaa"));
+  EXPECT_THAT(reductions, testing::Contains("gd"));
+
+  // Reductions are timed without the reductions they set up, so together they cannot take longer than the phase.
+  double reduction_seconds = 0.0;
+  for (const auto& reduction : profile.reductions) { reduction_seconds += reduction.seconds; }
+  EXPECT_LE(reduction_seconds, profile.phases[4].seconds);
+
+  const auto table = profile.to_string();
+  EXPECT_THAT(table, testing::HasSubstr("setup_reductions"));
+  EXPECT_THAT(table, testing::HasSubstr("Reduction setup"));
+}
+
+TEST(StartupProfile, ParallelNormalInitMatchesSerialValues)
+{
+  // 2^22 weights are split over several threads when the machine has them; every weight must still get the value
+  // of its own index.
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "--normal_weights", "-b", "22"));
+  auto& weights = vw->weights.dense_weights;
+  for (uint64_t i : {uint64_t{0}, uint64_t{1}, uint64_t{12345}, (uint64_t{1} << 22) - 1})
+  {
+    const uint64_t index = i << weights.stride_shift();
+    uint64_t state = index;
+    EXPECT_EQ(weights[index], VW::details::merand48_boxmuller(state)) << i;
+  }
+}
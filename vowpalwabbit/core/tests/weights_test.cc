@@ -2,12 +2,17 @@
 // individual contributors. All rights reserved. Released under a BSD (revised)
 // license as described in the file LICENSE.
 
+#include "vw/common/vw_exception.h"
+#include "vw/common/vw_throw.h"
 #include "vw/core/array_parameters.h"
 #include "vw/core/array_parameters_dense.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <vector>
+
 constexpr auto LENGTH = 16;
 constexpr auto STRIDE_SHIFT = 2;
 
@@ -24,4 +29,100 @@ TYPED_TEST(WeightTests, TestDefaultFunctionWeightInitializationStridedIndex)
   auto weight_initializer = [](VW::weight* weights, uint64_t index) { weights[0] = 1.f * index; };
   w.set_default(weight_initializer);
   for (size_t i = 0; i < LENGTH; i++) { EXPECT_FLOAT_EQ(w.strided_index(i), 1.f * (i * w.stride())); }
-}
\ No newline at end of file
+}
+TYPED_TEST(WeightTests, SetDefaultByIndexMatchesSetDefault)
+{
+  TypeParam by_index(LENGTH, STRIDE_SHIFT);
+  TypeParam serial(LENGTH, STRIDE_SHIFT);
+  auto weight_initializer = [](VW::weight* weights, uint64_t index)
+  {
+    weights[0] = 1.f * index;
+    weights[1] = 2.f;
+  };
+  by_index.set_default_by_index(weight_initializer);
+  serial.set_default(weight_initializer);
+  for (size_t i = 0; i < LENGTH; i++)
+  {
+    EXPECT_FLOAT_EQ(by_index.strided_index(i), serial.strided_index(i)) << i;
+    EXPECT_FLOAT_EQ((&by_index.strided_index(i))[1], (&serial.strided_index(i))[1]) << i;
+  }
+}
+
+TEST(DenseWeights, ParallelForBlocksCoversEveryIndexOnce)
+{
+  const uint64_t length = 5 * VW::details::PARALLEL_BLOCK_SIZE + 123;
+  for (size_t num_threads : {1, 2, 4, 16})
+  {
+    std::vector<uint8_t> visits(length, 0);
+    std::vector<uint8_t> blocks(6, 0);
+    VW::details::parallel_for_blocks(
+        length,
+        [&visits, &blocks, length](uint64_t begin, uint64_t end)
+        {
+          // Blocks do not depend on the number of threads.
+          EXPECT_EQ(begin % VW::details::PARALLEL_BLOCK_SIZE, 0u);
+          EXPECT_EQ(end, std::min(begin + VW::details::PARALLEL_BLOCK_SIZE, length));
+          blocks[begin / VW::details::PARALLEL_BLOCK_SIZE]++;
+          for (uint64_t i = begin; i < end; i++) { visits[i]++; }
+        },
+        num_threads);
+    EXPECT_THAT(visits, ::testing::Each(1)) << num_threads;
+    EXPECT_THAT(blocks, ::testing::Each(1)) << num_threads;
+  }
+}
+
+TEST(DenseWeights, ParallelForBlocksPropagatesExceptions)
+{
+  const uint64_t length = 4 * VW::details::PARALLEL_BLOCK_SIZE;
+  EXPECT_THROW(VW::details::parallel_for_blocks(
+                   length,
+                   [](uint64_t begin, uint64_t)
+                   {
+                     if (begin == 3 * VW::details::PARALLEL_BLOCK_SIZE) { THROW("block failed"); }
+                   },
+                   4),
+      VW::vw_exception);
+}
+
+TEST(DenseWeights, SetZeroClearsOnlyTheOffset)
+{
+  VW::dense_parameters w(3 * VW::details::PARALLEL_BLOCK_SIZE, STRIDE_SHIFT);
+  w.set_default_by_index(
+      [](VW::weight* weights, uint64_t)
+      {
+        for (size_t i = 0; i < 4; i++) { weights[i] = 1.f; }
+      });
+  w.set_zero(2);
+  for (uint64_t i = 0; i < w.raw_length(); i++) { EXPECT_EQ(w[i], (i % 4 == 2) ? 0.f : 1.f) << i; }
+}
+
+TEST(DenseWeights, ParseNumaNodeList)
+{
+  std::vector<int> nodes;
+  EXPECT_TRUE(VW::details::parse_numa_node_list("0", nodes));
+  EXPECT_THAT(nodes, ::testing::ElementsAre(0));
+  EXPECT_TRUE(VW::details::parse_numa_node_list("0,2-4", nodes));
+  EXPECT_THAT(nodes, ::testing::ElementsAre(0, 2, 3, 4));
+  for (const auto* bad : {"", "a", "1,", "3-1", "-1", "0-", "2048"})
+  {
+    EXPECT_FALSE(VW::details::parse_numa_node_list(bad, nodes)) << bad;
+  }
+}
+
+TEST(DenseWeights, HugePageAllocationsAreZeroedAndUsable)
+{
+  for (auto mode : {VW::huge_pages_mode::TRANSPARENT, VW::huge_pages_mode::EXPLICIT})
+  {
+    VW::dense_allocation_options allocation;
+    allocation.huge_pages = mode;
+    // Whichever huge pages the machine can give, the table must behave like a plain one.
+    VW::dense_parameters w(static_cast<size_t>(1) << 20, STRIDE_SHIFT, allocation);
+    ASSERT_TRUE(w.not_null());
+    if (mode == VW::huge_pages_mode::TRANSPARENT) { EXPECT_NE(w.huge_pages(), VW::huge_pages_mode::EXPLICIT); }
+    for (uint64_t i = 0; i < w.raw_length(); i += 4099) { EXPECT_EQ(w[i], 0.f); }
+    w.set_default_by_index([](VW::weight* weights, uint64_t index) { weights[0] = static_cast<float>(index); });
+
+    auto copy = VW::dense_parameters::deep_copy(w);
+    for (uint64_t i = 0; i < w.raw_length(); i += 4096) { EXPECT_EQ(copy[i], static_cast<float>(i)); }
+  }
+}
@@ -267,8 +267,9 @@ private:
       if (f.first.empty())
       {
         ns = " ";
-        _channel_hash =
-            _all->runtime_config.hash_seed == 0 ? 0 : VW::uniform_hash("", 0, _all->runtime_config.hash_seed);
+        _channel_hash = _all->runtime_config.hash_seed == 0
+            ? 0
+            : _all->parser_runtime.example_parser->uniform_hasher("", 0, _all->runtime_config.hash_seed);
       }
       else
       {
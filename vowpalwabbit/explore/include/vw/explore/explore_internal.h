@@ -8,6 +8,7 @@
 #include "vw/common/random.h"
 #include "vw/common/random_details.h"
 #include "vw/explore/explore_error_codes.h"
+#include "vw/explore/explore_simd_internal.h"
 
 #include <algorithm>
 #include <cassert>
@@ -86,6 +87,40 @@ int generate_softmax(float lambda, InputIt scores_first, InputIt scores_last, st
   return S_EXPLORATION_OK;
 }
 
+// Overloads for contiguous float ranges. Both const and non-const score pointers are provided so that these are always
+// a better match than the iterator template above.
+inline int generate_softmax(float lambda, const float* scores_first, const float* scores_last,
+    std::random_access_iterator_tag /* scores_tag */, float* pmf_first, float* pmf_last,
+    std::random_access_iterator_tag /* pmf_tag */)
+{
+  if (scores_last < scores_first || pmf_last < pmf_first) { return E_EXPLORATION_BAD_RANGE; }
+
+  const size_t num_actions = std::min<size_t>(scores_last - scores_first, pmf_last - pmf_first);
+
+  // zero out any pmf entries without a score
+  std::fill(pmf_first + num_actions, pmf_last, 0.f);
+  if (num_actions == 0) { return E_EXPLORATION_BAD_RANGE; }
+
+  scores_last = scores_first + num_actions;
+  pmf_last = pmf_first + num_actions;
+
+  const float max_score = lambda > 0 ? simd::max(scores_first, scores_last) : simd::min(scores_first, scores_last);
+  const float norm = simd::exp_and_sum(lambda, max_score, scores_first, scores_last, pmf_first);
+
+  // normalize
+  simd::multiply_add(pmf_first, pmf_last, 1.f / norm, 0.f);
+
+  return S_EXPLORATION_OK;
+}
+
+inline int generate_softmax(float lambda, float* scores_first, float* scores_last,
+    std::random_access_iterator_tag scores_tag, float* pmf_first, float* pmf_last,
+    std::random_access_iterator_tag pmf_tag)
+{
+  return generate_softmax(lambda, const_cast<const float*>(scores_first), const_cast<const float*>(scores_last),
+      scores_tag, pmf_first, pmf_last, pmf_tag);
+}
+
 template <typename InputIt, typename OutputIt>
 int generate_bag(InputIt top_actions_first, InputIt top_actions_last, std::input_iterator_tag /* top_actions_tag */,
     OutputIt pmf_first, OutputIt pmf_last, std::random_access_iterator_tag /* pmf_tag */)
@@ -174,6 +209,71 @@ int enforce_minimum_probability(float uniform_epsilon, bool consider_zero_valued
   return S_EXPLORATION_OK;
 }
 
+// Contiguous float version of the above. Rather than sorting the pmf, the threshold tau is found by repeatedly
+// projecting onto the set of entries that are still above the floor (Michelot's algorithm), where each step is a single
+// vectorized pass. This converges in a handful of passes in practice; pathological inputs fall back to the sort.
+inline int enforce_minimum_probability(float uniform_epsilon, bool consider_zero_valued_elements, float* pmf_first,
+    float* pmf_last, std::random_access_iterator_tag pmf_tag)
+{
+  if (pmf_first == pmf_last || pmf_last < pmf_first) { return E_EXPLORATION_BAD_RANGE; }
+
+  // Nothing to do
+  if (uniform_epsilon == 0.f) { return S_EXPLORATION_OK; }
+
+  if (uniform_epsilon < 0.f || uniform_epsilon > 1.f) { return E_EXPLORATION_BAD_EPSILON; }
+
+  const auto summary = simd::summarize(pmf_first, pmf_last);
+  if (summary.has_invalid)
+  {
+    return enforce_minimum_probability<float*>(
+        uniform_epsilon, consider_zero_valued_elements, pmf_first, pmf_last, pmf_tag);
+  }
+
+  const bool skip_zeros = !consider_zero_valued_elements;
+  const size_t num_actions = pmf_last - pmf_first;
+  const size_t support_size = skip_zeros ? num_actions - summary.num_zeros : num_actions;
+  if (support_size == 0) { return S_EXPLORATION_OK; }
+
+  if (uniform_epsilon > 0.999f)  // uniform exploration
+  {
+    const float prob = 1.f / support_size;
+    for (float* d = pmf_first; d != pmf_last; ++d)
+    {
+      if (!skip_zeros || *d > 0) { *d = prob; }
+    }
+    return S_EXPLORATION_OK;
+  }
+
+  const float minimum_probability = uniform_epsilon / support_size;
+
+  // Start with every supported entry active and shrink the active set until it is stable.
+  size_t active = support_size;
+  float active_sum = summary.sum;
+  float tau = 0.f;
+  constexpr int max_iterations = 64;
+  for (int i = 0;; ++i)
+  {
+    tau = ((support_size - active) * minimum_probability + active_sum - 1.f) / active;
+
+    size_t next_active = 0;
+    float next_active_sum = 0.f;
+    simd::count_and_sum_above(pmf_first, pmf_last, tau + minimum_probability, skip_zeros, next_active, next_active_sum);
+    if (next_active == active) { break; }
+
+    if (next_active == 0 || i == max_iterations)
+    {
+      return enforce_minimum_probability<float*>(
+          uniform_epsilon, consider_zero_valued_elements, pmf_first, pmf_last, pmf_tag);
+    }
+
+    active = next_active;
+    active_sum = next_active_sum;
+  }
+
+  simd::shift_and_floor(pmf_first, pmf_last, tau, minimum_probability, skip_zeros);
+  return S_EXPLORATION_OK;
+}
+
 template <typename It>
 int mix_with_uniform(float uniform_epsilon, It pmf_first, It pmf_last, std::random_access_iterator_tag /* pmf_tag */)
 {
@@ -191,6 +291,17 @@ int mix_with_uniform(float uniform_epsilon, It pmf_first, It pmf_last, std::rand
   return S_EXPLORATION_OK;
 }
 
+inline int mix_with_uniform(
+    float uniform_epsilon, float* pmf_first, float* pmf_last, std::random_access_iterator_tag /* pmf_tag */)
+{
+  if (pmf_first == pmf_last || pmf_last < pmf_first) { return E_EXPLORATION_BAD_RANGE; }
+
+  const size_t num_actions = pmf_last - pmf_first;
+  simd::multiply_add(pmf_first, pmf_last, 1.f - uniform_epsilon, uniform_epsilon / num_actions);
+
+  return S_EXPLORATION_OK;
+}
+
 // Warning: `seed` must be sufficiently random for the PRNG to produce uniform random values. Using sequential seeds
 // will result in a very biased distribution. If unsure how to update seed between calls, merand48 (in random_details.h)
 // can be used to inplace mutate it.
@@ -242,6 +353,33 @@ int sample_after_normalizing(
   return S_EXPLORATION_OK;
 }
 
+// Contiguous float version of the above. The running sum is compared against the draw a block at a time, so only the
+// block containing the chosen index is scanned sequentially.
+inline int sample_after_normalizing(
+    uint64_t seed, float* pmf_first, float* pmf_last, uint32_t& chosen_index, std::random_access_iterator_tag)
+{
+  if (pmf_first == pmf_last || pmf_last < pmf_first) { return E_EXPLORATION_BAD_RANGE; }
+
+  const float total = simd::clamp_negative_and_sum(pmf_first, pmf_last);
+
+  // assume the first is the best
+  if (total == 0)
+  {
+    chosen_index = 0;
+    *pmf_first = 1;
+    return S_EXPLORATION_OK;
+  }
+
+  float draw = total * VW::details::merand48_noadvance(seed);
+  if (draw > total)
+  {  // make very sure that draw can not be greater than total.
+    draw = total;
+  }
+
+  chosen_index = simd::normalize_and_find(pmf_first, pmf_last, total, draw);
+  return S_EXPLORATION_OK;
+}
+
 // Warning: `seed` must be sufficiently random for the PRNG to produce uniform random values. Using sequential seeds
 // will result in a very biased distribution.
 // If unsure how to update seed between calls, merand48 (in random_details.h) can be used to inplace mutate it.
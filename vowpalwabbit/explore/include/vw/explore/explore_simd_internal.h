@@ -0,0 +1,342 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+// Kernels over contiguous float ranges used by the raw pointer overloads in explore_internal.h. SSE2 is used when
+// available (always the case on x86-64), otherwise the kernels fall back to plain loops with independent accumulators
+// that the compiler is free to vectorize.
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if !defined(VW_NO_INLINE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#  define VW_EXPLORE_SSE2
+#  include <emmintrin.h>
+#endif
+
+namespace VW
+{
+namespace explore
+{
+namespace details
+{
+namespace simd
+{
+#ifdef VW_EXPLORE_SSE2
+inline float horizontal_sum(__m128 v)
+{
+  const __m128 shuf = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+  const __m128 sums = _mm_add_ps(v, shuf);
+  return _mm_cvtss_f32(_mm_add_ss(sums, _mm_movehl_ps(shuf, sums)));
+}
+
+inline float horizontal_max(__m128 v)
+{
+  const __m128 shuf = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+  const __m128 maxs = _mm_max_ps(v, shuf);
+  return _mm_cvtss_f32(_mm_max_ss(maxs, _mm_movehl_ps(shuf, maxs)));
+}
+
+inline float horizontal_min(__m128 v)
+{
+  const __m128 shuf = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+  const __m128 mins = _mm_min_ps(v, shuf);
+  return _mm_cvtss_f32(_mm_min_ss(mins, _mm_movehl_ps(shuf, mins)));
+}
+
+// Cephes style single precision exp. Arguments are expected to be within the normal range, see exp_and_sum.
+inline __m128 exp(__m128 x)
+{
+  const __m128 one = _mm_set1_ps(1.f);
+  x = _mm_min_ps(x, _mm_set1_ps(88.3762626647949f));
+  x = _mm_max_ps(x, _mm_set1_ps(-88.3762626647949f));
+
+  // express exp(x) as 2^n * exp(g) with |g| <= 0.5 * ln(2)
+  __m128 fx = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(1.44269504088896341f)), _mm_set1_ps(0.5f));
+  __m128 floor_fx = _mm_cvtepi32_ps(_mm_cvttps_epi32(fx));
+  floor_fx = _mm_sub_ps(floor_fx, _mm_and_ps(_mm_cmpgt_ps(floor_fx, fx), one));
+
+  x = _mm_sub_ps(x, _mm_mul_ps(floor_fx, _mm_set1_ps(0.693359375f)));
+  x = _mm_sub_ps(x, _mm_mul_ps(floor_fx, _mm_set1_ps(-2.12194440e-4f)));
+
+  __m128 y = _mm_set1_ps(1.9875691500E-4f);
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(1.3981999507E-3f));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(8.3334519073E-3f));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(4.1665795894E-2f));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(1.6666665459E-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(5.0000001201E-1f));
+  y = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(y, x), x), _mm_add_ps(x, one));
+
+  const __m128i exponent = _mm_slli_epi32(_mm_add_epi32(_mm_cvttps_epi32(floor_fx), _mm_set1_epi32(0x7f)), 23);
+  return _mm_mul_ps(y, _mm_castsi128_ps(exponent));
+}
+#endif
+
+inline float max(const float* first, const float* last)
+{
+  float result = *first;
+  const float* it = first;
+#ifdef VW_EXPLORE_SSE2
+  if (last - first >= 4)
+  {
+    __m128 acc = _mm_loadu_ps(first);
+    for (it = first + 4; it + 4 <= last; it += 4) { acc = _mm_max_ps(acc, _mm_loadu_ps(it)); }
+    result = horizontal_max(acc);
+  }
+#endif
+  for (; it != last; ++it) { result = std::max(result, *it); }
+  return result;
+}
+
+inline float min(const float* first, const float* last)
+{
+  float result = *first;
+  const float* it = first;
+#ifdef VW_EXPLORE_SSE2
+  if (last - first >= 4)
+  {
+    __m128 acc = _mm_loadu_ps(first);
+    for (it = first + 4; it + 4 <= last; it += 4) { acc = _mm_min_ps(acc, _mm_loadu_ps(it)); }
+    result = horizontal_min(acc);
+  }
+#endif
+  for (; it != last; ++it) { result = std::min(result, *it); }
+  return result;
+}
+
+// out[i] = exp(lambda * (in[i] - shift)), returns the sum of the outputs.
+inline float exp_and_sum(float lambda, float shift, const float* first, const float* last, float* out)
+{
+  float sum = 0.f;
+  const float* it = first;
+#ifdef VW_EXPLORE_SSE2
+  const __m128 lambda_v = _mm_set1_ps(lambda);
+  const __m128 shift_v = _mm_set1_ps(shift);
+  __m128 acc = _mm_setzero_ps();
+  const __m128 lowest = _mm_set1_ps(-87.3365447505531f);
+  const __m128 highest = _mm_set1_ps(88.3762626647949f);
+  for (; it + 4 <= last; it += 4, out += 4)
+  {
+    const __m128 x = _mm_mul_ps(lambda_v, _mm_sub_ps(_mm_loadu_ps(it), shift_v));
+    __m128 prob = exp(x);
+    // Arguments that underflow to a denormal or zero, overflow or are NaN go through std::exp so that exact zeros in
+    // the pmf match the scalar implementation.
+    if (_mm_movemask_ps(_mm_or_ps(_mm_cmpnge_ps(x, lowest), _mm_cmpnle_ps(x, highest))) != 0)
+    {
+      alignas(16) float lanes[4];
+      _mm_store_ps(lanes, x);
+      for (auto& lane : lanes) { lane = std::exp(lane); }
+      prob = _mm_load_ps(lanes);
+    }
+    acc = _mm_add_ps(acc, prob);
+    _mm_storeu_ps(out, prob);
+  }
+  sum = horizontal_sum(acc);
+#endif
+  for (; it != last; ++it, ++out)
+  {
+    *out = std::exp(lambda * (*it - shift));
+    sum += *out;
+  }
+  return sum;
+}
+
+// x[i] = x[i] * mult + add
+inline void multiply_add(float* first, float* last, float mult, float add)
+{
+  float* it = first;
+#ifdef VW_EXPLORE_SSE2
+  const __m128 mult_v = _mm_set1_ps(mult);
+  const __m128 add_v = _mm_set1_ps(add);
+  for (; it + 4 <= last; it += 4) { _mm_storeu_ps(it, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(it), mult_v), add_v)); }
+#endif
+  for (; it != last; ++it) { *it = *it * mult + add; }
+}
+
+// Replaces negative values with zero and returns the sum of the range.
+inline float clamp_negative_and_sum(float* first, float* last)
+{
+  float sum = 0.f;
+  float* it = first;
+#ifdef VW_EXPLORE_SSE2
+  const __m128 zero = _mm_setzero_ps();
+  __m128 acc = zero;
+  for (; it + 4 <= last; it += 4)
+  {
+    const __m128 v = _mm_max_ps(_mm_loadu_ps(it), zero);
+    _mm_storeu_ps(it, v);
+    acc = _mm_add_ps(acc, v);
+  }
+  sum = horizontal_sum(acc);
+#endif
+  for (; it != last; ++it)
+  {
+    if (*it < 0) { *it = 0; }
+    sum += *it;
+  }
+  return sum;
+}
+
+// Single pass summary used by enforce_minimum_probability.
+class range_summary
+{
+public:
+  size_t num_zeros = 0;
+  float sum = 0.f;
+  // Set if any element is negative or NaN.
+  bool has_invalid = false;
+};
+
+inline range_summary summarize(const float* first, const float* last)
+{
+  range_summary summary;
+  const float* it = first;
+#ifdef VW_EXPLORE_SSE2
+  const __m128 zero = _mm_setzero_ps();
+  __m128 sum_acc = zero;
+  __m128i zeros_acc = _mm_setzero_si128();
+  int invalid_mask = 0;
+  for (; it + 4 <= last; it += 4)
+  {
+    const __m128 v = _mm_loadu_ps(it);
+    const __m128 is_zero = _mm_cmpeq_ps(v, zero);
+    // negative and NaN elements both fail v >= 0
+    invalid_mask |= _mm_movemask_ps(_mm_cmpnge_ps(v, zero));
+    sum_acc = _mm_add_ps(sum_acc, v);
+    // all ones lanes are -1 as integers
+    zeros_acc = _mm_sub_epi32(zeros_acc, _mm_castps_si128(is_zero));
+  }
+  alignas(16) int32_t zeros[4];
+  _mm_store_si128(reinterpret_cast<__m128i*>(zeros), zeros_acc);
+  summary.num_zeros = static_cast<size_t>(zeros[0]) + zeros[1] + zeros[2] + zeros[3];
+  summary.sum = horizontal_sum(sum_acc);
+  summary.has_invalid = invalid_mask != 0;
+#endif
+  for (; it != last; ++it)
+  {
+    if (!(*it >= 0.f)) { summary.has_invalid = true; }
+    if (*it == 0.f) { summary.num_zeros++; }
+    summary.sum += *it;
+  }
+  return summary;
+}
+
+// Counts and sums the elements strictly greater than threshold. Elements equal to zero are skipped when skip_zeros is
+// set.
+inline void count_and_sum_above(
+    const float* first, const float* last, float threshold, bool skip_zeros, size_t& count, float& sum)
+{
+  count = 0;
+  sum = 0.f;
+  const float* it = first;
+#ifdef VW_EXPLORE_SSE2
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 threshold_v = _mm_set1_ps(threshold);
+  __m128 sum_acc = zero;
+  __m128i count_acc = _mm_setzero_si128();
+  for (; it + 4 <= last; it += 4)
+  {
+    const __m128 v = _mm_loadu_ps(it);
+    __m128 mask = _mm_cmpgt_ps(v, threshold_v);
+    if (skip_zeros) { mask = _mm_andnot_ps(_mm_cmpeq_ps(v, zero), mask); }
+    sum_acc = _mm_add_ps(sum_acc, _mm_and_ps(mask, v));
+    count_acc = _mm_sub_epi32(count_acc, _mm_castps_si128(mask));
+  }
+  alignas(16) int32_t counts[4];
+  _mm_store_si128(reinterpret_cast<__m128i*>(counts), count_acc);
+  count = static_cast<size_t>(counts[0]) + counts[1] + counts[2] + counts[3];
+  sum = horizontal_sum(sum_acc);
+#endif
+  for (; it != last; ++it)
+  {
+    if (*it > threshold && !(skip_zeros && *it == 0.f))
+    {
+      count++;
+      sum += *it;
+    }
+  }
+}
+
+// x[i] = max(x[i] - tau, floor). Elements equal to zero are left untouched when skip_zeros is set.
+inline void shift_and_floor(float* first, float* last, float tau, float floor, bool skip_zeros)
+{
+  float* it = first;
+#ifdef VW_EXPLORE_SSE2
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 tau_v = _mm_set1_ps(tau);
+  const __m128 floor_v = _mm_set1_ps(floor);
+  for (; it + 4 <= last; it += 4)
+  {
+    const __m128 v = _mm_loadu_ps(it);
+    __m128 updated = _mm_max_ps(_mm_sub_ps(v, tau_v), floor_v);
+    if (skip_zeros)
+    {
+      const __m128 is_zero = _mm_cmpeq_ps(v, zero);
+      updated = _mm_or_ps(_mm_and_ps(is_zero, v), _mm_andnot_ps(is_zero, updated));
+    }
+    _mm_storeu_ps(it, updated);
+  }
+#endif
+  for (; it != last; ++it)
+  {
+    if (!skip_zeros || *it != 0.f) { *it = std::max(*it - tau, floor); }
+  }
+}
+
+// Normalizes the range by total and returns the index of the first element at which the running sum of the
+// unnormalized values exceeds draw. Returns the last index if no such element exists. Whole blocks are skipped using
+// their partial sums so the scan is only sequential inside the block that contains the draw.
+inline uint32_t normalize_and_find(float* first, float* last, float total, float draw)
+{
+  const float inv_total = 1.f / total;
+  const auto size = static_cast<uint32_t>(last - first);
+  bool index_found = false;
+  uint32_t chosen_index = size - 1;
+  float sum = 0.f;
+  uint32_t i = 0;
+#ifdef VW_EXPLORE_SSE2
+  const __m128 inv_total_v = _mm_set1_ps(inv_total);
+  for (; i + 4 <= size; i += 4)
+  {
+    const __m128 v = _mm_loadu_ps(first + i);
+    if (!index_found)
+    {
+      const float block_sum = horizontal_sum(v);
+      if (sum + block_sum > draw)
+      {
+        for (uint32_t j = i; j < i + 4; ++j)
+        {
+          sum += first[j];
+          if (sum > draw)
+          {
+            chosen_index = j;
+            index_found = true;
+            break;
+          }
+        }
+      }
+      else { sum += block_sum; }
+    }
+    _mm_storeu_ps(first + i, _mm_mul_ps(v, inv_total_v));
+  }
+#endif
+  for (; i < size; ++i)
+  {
+    sum += first[i];
+    if (!index_found && sum > draw)
+    {
+      chosen_index = i;
+      index_found = true;
+    }
+    first[i] *= inv_total;
+  }
+  return chosen_index;
+}
+}  // namespace simd
+}  // namespace details
+}  // namespace explore
+}  // namespace VW
@@ -11,6 +11,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <random>
 #include <vector>
 
 using namespace VW::continuous_actions;
@@ -500,4 +501,116 @@ TEST(Explore, MixWithUniformTest3)
 
   EXPECT_EQ(probs[2].action, 3);
   EXPECT_FLOAT_EQ(probs[2].score, 0.1f);
-}
\ No newline at end of file
+}
+
+// The raw pointer overloads use the vectorized kernels, a std::vector iterator always goes through the generic
+// implementation. Sizes are chosen to exercise both the vector body and the scalar tail.
+namespace
+{
+std::vector<float> random_scores(size_t size, uint32_t seed)
+{
+  std::mt19937 gen(seed);
+  std::normal_distribution<float> dist(0.f, 3.f);
+  std::vector<float> scores(size);
+  for (auto& score : scores) { score = dist(gen); }
+  return scores;
+}
+}  // namespace
+
+TEST(Explore, ContiguousSoftmaxMatchesGeneric)
+{
+  for (size_t size : {1, 3, 4, 17, 1000, 1003})
+  {
+    for (float lambda : {-2.f, 0.f, 0.5f, 30.f})
+    {
+      const auto scores = random_scores(size, static_cast<uint32_t>(size));
+      std::vector<float> expected(size);
+      std::vector<float> actual(size);
+      ASSERT_EQ(S_EXPLORATION_OK,
+          VW::explore::generate_softmax(lambda, scores.begin(), scores.end(), expected.begin(), expected.end()));
+      ASSERT_EQ(S_EXPLORATION_OK,
+          VW::explore::generate_softmax(
+              lambda, scores.data(), scores.data() + size, actual.data(), actual.data() + size));
+      EXPECT_THAT(actual, Pointwise(FloatNear(1e-6f), expected));
+      for (size_t i = 0; i < size; ++i) { EXPECT_EQ(expected[i] == 0.f, actual[i] == 0.f); }
+    }
+  }
+}
+
+TEST(Explore, ContiguousSoftmaxImbalanced)
+{
+  std::vector<float> scores = {1, 2, 3};
+  std::vector<float> pdf(4);
+  EXPECT_THAT(S_EXPLORATION_OK,
+      VW::explore::generate_softmax(0.2f, scores.data(), scores.data() + 3, pdf.data(), pdf.data() + 4));
+  EXPECT_THAT(pdf, Pointwise(FloatNear(1e-3f), std::vector<float>{0.269f, 0.328f, 0.401f, 0}));
+}
+
+TEST(Explore, ContiguousEnforceMinimumProbabilityMatchesGeneric)
+{
+  for (size_t size : {1, 3, 4, 17, 1000, 1003})
+  {
+    for (float epsilon : {0.05f, 0.3f, 1.f})
+    {
+      for (bool consider_zero_valued_elements : {true, false})
+      {
+        auto pdf = random_scores(size, static_cast<uint32_t>(size) + 1);
+        VW::explore::generate_softmax(2.f, pdf.data(), pdf.data() + size, pdf.data(), pdf.data() + size);
+        for (size_t i = 0; i < size; i += 5) { pdf[i] = 0.f; }
+
+        auto expected = pdf;
+        auto actual = pdf;
+        ASSERT_EQ(S_EXPLORATION_OK,
+            VW::explore::enforce_minimum_probability(
+                epsilon, consider_zero_valued_elements, expected.begin(), expected.end()));
+        ASSERT_EQ(S_EXPLORATION_OK,
+            VW::explore::enforce_minimum_probability(
+                epsilon, consider_zero_valued_elements, actual.data(), actual.data() + size));
+        EXPECT_THAT(actual, Pointwise(FloatNear(1e-6f), expected));
+      }
+    }
+  }
+}
+
+TEST(Explore, ContiguousEnforceMinimumProbabilityNegative)
+{
+  std::vector<float> expected = {0.9f, -0.1f, 0.2f, 0.f, 0.f};
+  auto actual = expected;
+  VW::explore::enforce_minimum_probability(0.2f, true, expected.begin(), expected.end());
+  VW::explore::enforce_minimum_probability(0.2f, true, actual.data(), actual.data() + actual.size());
+  EXPECT_THAT(actual, Pointwise(FloatNear(1e-6f), expected));
+}
+
+TEST(Explore, ContiguousMixWithUniformMatchesGeneric)
+{
+  auto expected = random_scores(1003, 7);
+  VW::explore::generate_softmax(1.f, expected.data(), expected.data() + expected.size(), expected.data(),
+      expected.data() + expected.size());
+  auto actual = expected;
+  VW::explore::mix_with_uniform(0.3f, expected.begin(), expected.end());
+  VW::explore::mix_with_uniform(0.3f, actual.data(), actual.data() + actual.size());
+  EXPECT_THAT(actual, Pointwise(FloatNear(1e-7f), expected));
+}
+
+TEST(Explore, ContiguousSampleAfterNormalizing)
+{
+  std::vector<float> pdf = {0.8f, 0.1f, 0.1f, 0.2f, 0.f, -1.f, 0.4f};
+  std::vector<float> histogram(pdf.size());
+  const std::vector<float> expected = {0.5f, 0.0625f, 0.0625f, 0.125f, 0.f, 0.f, 0.25f};
+
+  size_t rep = 10000;
+  uint64_t seed = 1234;
+  for (size_t i = 0; i < rep; i++)
+  {
+    auto copy = pdf;
+    uint32_t chosen_index = 0;
+    ASSERT_EQ(S_EXPLORATION_OK,
+        VW::explore::sample_after_normalizing(seed, copy.data(), copy.data() + copy.size(), chosen_index));
+    EXPECT_THAT(copy, Pointwise(FloatNear(1e-6f), expected));
+    histogram[chosen_index]++;
+    VW::details::merand48(seed);
+  }
+  for (auto& d : histogram) { d /= rep; }
+
+  EXPECT_THAT(histogram, Pointwise(FloatNear(1e-2f), expected));
+}
@@ -124,5 +124,25 @@ std::unique_ptr<writer> create_vector_writer(std::shared_ptr<std::vector<char>>&
 /// \param len length of buffer
 std::unique_ptr<reader> create_buffer_view(const char* data, size_t len);
 
+/// Wraps a writer so that everything written through it is deflated as a single
+/// zlib stream. The stream is finished when the returned writer is destroyed.
+/// \param inner the writer that receives the compressed bytes
+std::unique_ptr<writer> create_zlib_writer(std::unique_ptr<writer> inner);
+
+/// Wraps a reader that produces a zlib stream written by create_zlib_writer and
+/// inflates it. The inner reader may be read past the end of the zlib stream.
+/// \param inner the reader that produces the compressed bytes
+std::unique_ptr<reader> create_zlib_reader(std::unique_ptr<reader> inner);
+
+/// Wraps a writer so that the writes to it happen on a background thread. Writes
+/// are collected into buffers of buffer_size bytes, and each full buffer is
+/// handed to the thread as one write to the inner writer. flush() returns once
+/// everything written so far has reached the inner writer. Pending data is
+/// written when the returned writer is destroyed. If the inner writer fails,
+/// later writes return -1 with errno set to the failure.
+/// \param inner the writer that receives the buffered bytes
+/// \param buffer_size the number of bytes collected before a buffer is handed off
+std::unique_ptr<writer> create_background_writer(std::unique_ptr<writer> inner, size_t buffer_size);
+
 }  // namespace io
 }  // namespace VW
@@ -24,10 +24,16 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cerrno>
+#include <condition_variable>
 #include <cstdio>
 #include <cstring>
+#include <deque>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <mutex>
+#include <thread>
 #include <vector>
 #if (ZLIB_VERNUM < 0x1252)
 typedef void* gzFile;
@@ -182,6 +188,66 @@ private:
   size_t _len;
 };
 
+class zlib_writer_adapter : public writer
+{
+public:
+  zlib_writer_adapter(std::unique_ptr<writer> inner);
+  ~zlib_writer_adapter() override;
+  ssize_t write(const char* buffer, size_t num_bytes) override;
+  void flush() override;
+
+private:
+  void deflate_to_inner(int flush_mode);
+
+  std::unique_ptr<writer> _inner;
+  z_stream _stream;
+  std::vector<char> _output;
+};
+
+class background_writer_adapter : public writer
+{
+public:
+  background_writer_adapter(std::unique_ptr<writer> inner, size_t buffer_size);
+  ~background_writer_adapter() override;
+  ssize_t write(const char* buffer, size_t num_bytes) override;
+  void flush() override;
+
+private:
+  // At most this many full buffers wait for the thread before write blocks.
+  static constexpr size_t MAX_QUEUED_BUFFERS = 4;
+
+  void hand_off();
+  void run();
+
+  std::unique_ptr<writer> _inner;
+  size_t _buffer_size;
+  // Only touched by the writing thread.
+  std::vector<char> _filling;
+
+  std::mutex _lock;
+  std::condition_variable _changed;
+  std::deque<std::vector<char>> _queued;
+  std::vector<std::vector<char>> _spare;
+  bool _writing = false;
+  bool _done = false;
+  int _error = 0;
+  std::thread _thread;
+};
+
+class zlib_reader_adapter : public reader
+{
+public:
+  zlib_reader_adapter(std::unique_ptr<reader> inner);
+  ~zlib_reader_adapter() override;
+  ssize_t read(char* buffer, size_t num_bytes) override;
+
+private:
+  std::unique_ptr<reader> _inner;
+  z_stream _stream;
+  std::vector<char> _input;
+  bool _stream_ended;
+};
+
 namespace VW
 {
 namespace io
@@ -232,6 +298,21 @@ std::unique_ptr<reader> create_buffer_view(const char* data, size_t len)
 {
   return std::unique_ptr<reader>(new buffer_view(data, len));
 }
+
+std::unique_ptr<writer> create_zlib_writer(std::unique_ptr<writer> inner)
+{
+  return std::unique_ptr<writer>(new zlib_writer_adapter(std::move(inner)));
+}
+
+std::unique_ptr<reader> create_zlib_reader(std::unique_ptr<reader> inner)
+{
+  return std::unique_ptr<reader>(new zlib_reader_adapter(std::move(inner)));
+}
+
+std::unique_ptr<writer> create_background_writer(std::unique_ptr<writer> inner, size_t buffer_size)
+{
+  return std::unique_ptr<writer>(new background_writer_adapter(std::move(inner), buffer_size));
+}
 }  // namespace io
 }  // namespace VW
 
@@ -428,6 +509,205 @@ ssize_t gzip_stdio_adapter::write(const char* buffer, size_t num_bytes)
   return (num_written > 0) ? static_cast<size_t>(num_written) : 0;
 }
 
+//
+// zlib_writer_adapter
+//
+
+constexpr size_t ZLIB_CHUNK_SIZE = 1 << 16;
+
+zlib_writer_adapter::zlib_writer_adapter(std::unique_ptr<writer> inner)
+    : _inner(std::move(inner)), _stream(), _output(ZLIB_CHUNK_SIZE)
+{
+  if (deflateInit(&_stream, Z_DEFAULT_COMPRESSION) != Z_OK) { THROW("Failed to initialize zlib compression"); }
+}
+
+zlib_writer_adapter::~zlib_writer_adapter()
+{
+  try
+  {
+    deflate_to_inner(Z_FINISH);
+    _inner->flush();
+  }
+  catch (...)
+  {
+  }
+  deflateEnd(&_stream);
+}
+
+void zlib_writer_adapter::deflate_to_inner(int flush_mode)
+{
+  do {
+    _stream.next_out = reinterpret_cast<Bytef*>(_output.data());
+    _stream.avail_out = static_cast<uInt>(_output.size());
+    if (deflate(&_stream, flush_mode) == Z_STREAM_ERROR) { THROW("zlib compression failed"); }
+    const auto num_compressed = _output.size() - _stream.avail_out;
+    if (num_compressed > 0) { _inner->write(_output.data(), num_compressed); }
+  } while (_stream.avail_out == 0);
+}
+
+ssize_t zlib_writer_adapter::write(const char* buffer, size_t num_bytes)
+{
+  size_t remaining = num_bytes;
+  while (remaining > 0)
+  {
+    const auto chunk = std::min(remaining, ZLIB_CHUNK_SIZE);
+    _stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(buffer));
+    _stream.avail_in = static_cast<uInt>(chunk);
+    deflate_to_inner(Z_NO_FLUSH);
+    buffer += chunk;
+    remaining -= chunk;
+  }
+  return num_bytes;
+}
+
+void zlib_writer_adapter::flush()
+{
+  deflate_to_inner(Z_SYNC_FLUSH);
+  _inner->flush();
+}
+
+//
+// background_writer_adapter
+//
+
+background_writer_adapter::background_writer_adapter(std::unique_ptr<writer> inner, size_t buffer_size)
+    : _inner(std::move(inner)), _buffer_size(std::max<size_t>(buffer_size, 1))
+{
+  _filling.reserve(_buffer_size);
+  _thread = std::thread(&background_writer_adapter::run, this);
+}
+
+background_writer_adapter::~background_writer_adapter()
+{
+  try
+  {
+    flush();
+  }
+  catch (...)
+  {
+  }
+  {
+    std::lock_guard<std::mutex> lock(_lock);
+    _done = true;
+  }
+  _changed.notify_all();
+  _thread.join();
+}
+
+ssize_t background_writer_adapter::write(const char* buffer, size_t num_bytes)
+{
+  {
+    std::lock_guard<std::mutex> lock(_lock);
+    if (_error != 0)
+    {
+      errno = _error;
+      return -1;
+    }
+  }
+  _filling.insert(_filling.end(), buffer, buffer + num_bytes);
+  if (_filling.size() >= _buffer_size) { hand_off(); }
+  return static_cast<ssize_t>(num_bytes);
+}
+
+void background_writer_adapter::flush()
+{
+  if (!_filling.empty()) { hand_off(); }
+  std::unique_lock<std::mutex> lock(_lock);
+  _changed.wait(lock, [this] { return _queued.empty() && !_writing; });
+  // The thread is idle until the next hand off, so the inner writer can be used here.
+  _inner->flush();
+}
+
+void background_writer_adapter::hand_off()
+{
+  std::unique_lock<std::mutex> lock(_lock);
+  _changed.wait(lock, [this] { return _queued.size() < MAX_QUEUED_BUFFERS; });
+  _queued.push_back(std::move(_filling));
+  if (_spare.empty()) { _filling = std::vector<char>(); }
+  else
+  {
+    _filling = std::move(_spare.back());
+    _spare.pop_back();
+  }
+  _filling.reserve(_buffer_size);
+  lock.unlock();
+  _changed.notify_all();
+}
+
+void background_writer_adapter::run()
+{
+  std::unique_lock<std::mutex> lock(_lock);
+  while (true)
+  {
+    _changed.wait(lock, [this] { return !_queued.empty() || _done; });
+    if (_queued.empty()) { return; }
+
+    auto buffer = std::move(_queued.front());
+    _queued.pop_front();
+    _writing = true;
+    const bool failed = _error != 0;
+    lock.unlock();
+
+    int error = 0;
+    // After a failure the remaining buffers are dropped.
+    for (size_t written = 0; !failed && written < buffer.size();)
+    {
+      const auto num_written = _inner->write(buffer.data() + written, buffer.size() - written);
+      if (num_written <= 0)
+      {
+        error = num_written < 0 && errno != 0 ? errno : EIO;
+        break;
+      }
+      written += static_cast<size_t>(num_written);
+    }
+    buffer.clear();
+
+    lock.lock();
+    if (error != 0 && _error == 0) { _error = error; }
+    _spare.push_back(std::move(buffer));
+    _writing = false;
+    _changed.notify_all();
+  }
+}
+
+//
+// zlib_reader_adapter
+//
+
+zlib_reader_adapter::zlib_reader_adapter(std::unique_ptr<reader> inner)
+    : reader(false /*is_resettable*/)
+    , _inner(std::move(inner))
+    , _stream()
+    , _input(ZLIB_CHUNK_SIZE)
+    , _stream_ended(false)
+{
+  if (inflateInit(&_stream) != Z_OK) { THROW("Failed to initialize zlib decompression"); }
+}
+
+zlib_reader_adapter::~zlib_reader_adapter() { inflateEnd(&_stream); }
+
+ssize_t zlib_reader_adapter::read(char* buffer, size_t num_bytes)
+{
+  _stream.next_out = reinterpret_cast<Bytef*>(buffer);
+  _stream.avail_out = static_cast<uInt>(std::min(num_bytes, static_cast<size_t>(std::numeric_limits<uInt>::max())));
+  const auto requested = _stream.avail_out;
+  while (_stream.avail_out > 0 && !_stream_ended)
+  {
+    if (_stream.avail_in == 0)
+    {
+      const auto num_read = _inner->read(_input.data(), _input.size());
+      if (num_read <= 0) { break; }
+      _stream.next_in = reinterpret_cast<Bytef*>(_input.data());
+      _stream.avail_in = static_cast<uInt>(num_read);
+    }
+
+    const auto status = inflate(&_stream, Z_NO_FLUSH);
+    if (status == Z_STREAM_END) { _stream_ended = true; }
+    else if (status != Z_OK && status != Z_BUF_ERROR) { THROW("zlib decompression failed: corrupt input"); }
+  }
+  return static_cast<ssize_t>(requested - _stream.avail_out);
+}
+
 //
 // vector_writer
 //
@@ -10,6 +10,8 @@
 #include <array>
 #include <cstring>
 #include <memory>
+#include <string>
+#include <vector>
 
 TEST(IoAdapter, IoAdapterVectorWriter)
 {
@@ -59,3 +61,55 @@ TEST(IoAdapter, IoAdapterBufferView)
     EXPECT_EQ(std::strncmp(read_buffer3, "test another", 13), 0);
   }
 }
+
+TEST(IoAdapter, IoAdapterZlibRoundTrip)
+{
+  std::string input;
+  for (int i = 0; i < 20000; i++) { input += "chunk " + std::to_string(i % 97) + " "; }
+
+  auto buffer = std::make_shared<std::vector<char>>();
+  {
+    auto zlib_writer = VW::io::create_zlib_writer(VW::io::create_vector_writer(buffer));
+    EXPECT_EQ(zlib_writer->write(input.data(), 10), 10);
+    EXPECT_EQ(zlib_writer->write(input.data() + 10, input.size() - 10), input.size() - 10);
+  }
+  EXPECT_LT(buffer->size(), input.size());
+
+  auto zlib_reader = VW::io::create_zlib_reader(VW::io::create_buffer_view(buffer->data(), buffer->size()));
+  std::vector<char> output(input.size() + 1000);
+  size_t total = 0;
+  ssize_t num_read = 0;
+  while ((num_read = zlib_reader->read(output.data() + total, 1000)) > 0) { total += num_read; }
+  EXPECT_EQ(total, input.size());
+  EXPECT_EQ(std::string(output.data(), total), input);
+}
+
+TEST(IoAdapter, IoAdapterBackgroundWriter)
+{
+  std::string expected;
+  auto buffer = std::make_shared<std::vector<char>>();
+  {
+    auto background_writer = VW::io::create_background_writer(VW::io::create_vector_writer(buffer), 64);
+    for (int i = 0; i < 5000; i++)
+    {
+      const auto line = std::to_string(i) + "\n";
+      EXPECT_EQ(background_writer->write(line.data(), line.size()), line.size());
+      expected += line;
+    }
+    background_writer->flush();
+    EXPECT_EQ(std::string(buffer->data(), buffer->size()), expected);
+
+    EXPECT_EQ(background_writer->write("tail", 4), 4);
+    expected += "tail";
+  }
+  EXPECT_EQ(std::string(buffer->data(), buffer->size()), expected);
+}
+
+TEST(IoAdapter, IoAdapterBackgroundWriterReportsFailure)
+{
+  auto failing_writer = VW::io::create_custom_writer(nullptr, [](void*, const char*, size_t) -> ssize_t { return -1; });
+  auto background_writer = VW::io::create_background_writer(std::move(failing_writer), 1);
+  EXPECT_EQ(background_writer->write("a", 1), 1);
+  background_writer->flush();
+  EXPECT_EQ(background_writer->write("b", 1), -1);
+}
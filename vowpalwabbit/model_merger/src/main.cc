@@ -78,6 +78,8 @@ public:
   std::string output_file;
   std::string base_file;
   std::vector<std::string> input_files;
+  bool streaming = false;
+  uint64_t threads = 0;
 };
 
 command_line_options parse_command_line(int argc, char** argv, VW::io::logger& logger)
@@ -103,11 +105,25 @@ command_line_options parse_command_line(int argc, char** argv, VW::io::logger& l
       make_option("output", output_file).short_name('o').help("Name of file of merged model. Required."));
   output_options.add(make_option("base", base_file).short_name('b').help("Name of file the base model."));
 
+  bool streaming = false;
+  uint64_t threads = 0;
+  option_group_definition performance_options("Performance");
+  performance_options.add(make_option("streaming", streaming)
+                              .help("Load and merge one model at a time instead of loading all models up front. "
+                                    "Memory use does not grow with the number of models: besides the base model, at "
+                                    "most three models are held at once (the merged output, the model being merged "
+                                    "and its delta from the base or the next model being loaded)."));
+  performance_options.add(make_option("threads", threads)
+                              .default_value(0)
+                              .help("Number of threads used to combine weights and load the next model while "
+                                    "merging in streaming mode. 0 merges on the main thread."));
+
   std::vector<std::string> args(argv + 1, argv + argc);
   options_cli options(args);
 
   options.add_and_parse(diagnostics_options);
   options.add_and_parse(output_options);
+  options.add_and_parse(performance_options);
   auto warnings = options.check_unregistered();
   _UNUSED(warnings);
 
@@ -138,6 +154,8 @@ command_line_options parse_command_line(int argc, char** argv, VW::io::logger& l
   result.output_file = output_file;
   result.base_file = base_file;
   result.input_files = model_files;
+  result.streaming = streaming;
+  result.threads = threads;
 
   return result;
 }
@@ -151,38 +169,51 @@ int main(int argc, char* argv[])
     logger.set_level(options.log_level);
     logger.set_location(options.log_output_stream);
 
-    std::vector<std::unique_ptr<VW::workspace>> models;
+    // Contexts are created up front so the pointers held by the custom loggers stay valid.
     std::vector<logger_context> logger_contexts;
-    for (const auto& model_file : options.input_files)
-    {
-      logger.info("Loading model: {}", model_file);
-      logger_contexts.push_back(logger_context{logger, model_file});
+    logger_contexts.reserve(options.input_files.size() + 2);
+    for (const auto& model_file : options.input_files) { logger_contexts.push_back(logger_context{logger, model_file}); }
+    logger_contexts.push_back(logger_context{logger, "dest: " + options.input_files[0]});
+    logger_contexts.push_back(logger_context{logger, "base: " + options.base_file});
 
-      auto custom_logger = VW::io::create_custom_sink_logger(&logger_contexts.back(), logger_output_func);
-      auto model = VW::initialize(VW::make_unique<VW::config::options_cli>(std::vector<std::string>{
-                                      "--driver_output_off", "--preserve_performance_counters"}),
-          VW::io::open_file_reader(model_file), nullptr, nullptr, &custom_logger);
-      models.push_back(std::move(model));
-    }
+    auto load_model = [&options, &logger, &logger_contexts](size_t i)
+    {
+      logger.info("Loading model: {}", options.input_files[i]);
+      auto custom_logger = VW::io::create_custom_sink_logger(&logger_contexts[i], logger_output_func);
+      return VW::initialize(VW::make_unique<VW::config::options_cli>(std::vector<std::string>{
+                                "--driver_output_off", "--preserve_performance_counters"}),
+          VW::io::open_file_reader(options.input_files[i]), nullptr, nullptr, &custom_logger);
+    };
 
-    logger_contexts.push_back(logger_context{logger, "dest: " + options.input_files[0]});
-    auto custom_logger = VW::io::create_custom_sink_logger(&logger_contexts.back(), logger_output_func);
-    std::vector<const VW::workspace*> const_workspaces;
-    const_workspaces.reserve(models.size());
-    for (const auto& model : models) { const_workspaces.push_back(model.get()); }
+    auto custom_logger =
+        VW::io::create_custom_sink_logger(&logger_contexts[options.input_files.size()], logger_output_func);
 
     std::unique_ptr<VW::workspace> base_model = nullptr;
     if (!options.base_file.empty())
     {
       logger.info("Loading base model: {}", options.base_file);
-      logger_contexts.push_back(logger_context{logger, "base: " + options.base_file});
-      auto custom_logger = VW::io::create_custom_sink_logger(&logger_contexts.back(), logger_output_func);
+      auto base_logger = VW::io::create_custom_sink_logger(&logger_contexts.back(), logger_output_func);
       base_model = VW::initialize(VW::make_unique<VW::config::options_cli>(std::vector<std::string>{
                                       "--driver_output_off", "--preserve_performance_counters"}),
-          VW::io::open_file_reader(options.base_file), nullptr, nullptr, &custom_logger);
+          VW::io::open_file_reader(options.base_file), nullptr, nullptr, &base_logger);
+    }
+
+    std::unique_ptr<VW::workspace> merged;
+    if (options.streaming)
+    {
+      merged = VW::merge_models_streaming(
+          base_model.get(), options.input_files.size(), load_model, options.threads, &custom_logger);
     }
+    else
+    {
+      std::vector<std::unique_ptr<VW::workspace>> models;
+      for (size_t i = 0; i < options.input_files.size(); i++) { models.push_back(load_model(i)); }
 
-    auto merged = VW::merge_models(base_model.get(), const_workspaces, &custom_logger);
+      std::vector<const VW::workspace*> const_workspaces;
+      const_workspaces.reserve(models.size());
+      for (const auto& model : models) { const_workspaces.push_back(model.get()); }
+      merged = VW::merge_models(base_model.get(), const_workspaces, &custom_logger);
+    }
 
     logger.info("Saving model: {}", options.output_file);
     VW::save_predictor(*merged, options.output_file);
@@ -13,6 +13,7 @@
 #include "vw/core/array_parameters_dense.h"
 #include "vw/core/example_predict.h"
 #include "vw/core/gd_predict.h"
+#include "vw/core/hashstring.h"
 #include "vw/core/interactions.h"
 #include "vw/explore/explore.h"
 
@@ -131,6 +132,12 @@ public:
       return E_VW_PREDICT_ERR_HASH_SEED_NOT_SUPPORTED;
     }
 
+    // feature names must be hashed with the algorithm the model was trained with
+    std::vector<std::string> hash_algorithm = find_opt(_command_line_arguments, "--hash_algorithm");
+    if (hash_algorithm.empty() || hash_algorithm.back() == "murmur3") { _hasher = VW::details::hashstring; }
+    else if (hash_algorithm.back() == "wyhash") { _hasher = VW::details::hashstring_wyhash; }
+    else { return E_VW_PREDICT_ERR_HASH_ALGORITHM_NOT_SUPPORTED; }
+
     _interactions.clear();
     find_opt(_command_line_arguments, "-q", _interactions);
     find_opt(_command_line_arguments, "--quadratic", _interactions);
@@ -350,8 +357,9 @@ public:
         RETURN_ON_FAIL(predict(shared, actions, num_actions, scores));
 
         // generate exploration distribution
+        // raw pointers select the vectorized implementation
         RETURN_EXPLORATION_ON_FAIL(VW::explore::generate_softmax(
-            _lambda, std::begin(scores), std::end(scores), std::begin(pdf), std::end(pdf)));
+            _lambda, scores.data(), scores.data() + scores.size(), pdf.data(), pdf.data() + pdf.size()));
         break;
       }
       case vw_predict_exploration::bag:
@@ -467,6 +475,12 @@ public:
 
   uint32_t feature_index_num_bits() { return _num_bits; }
 
+  /**
+   * @brief The string hash function the model was trained with. Pass it to example_predict_builder so that feature
+   * names are hashed the same way.
+   */
+  VW::hash_func_t feature_hasher() { return _hasher; }
+
 private:
   std::unique_ptr<W> _weights;
   std::string _id;
@@ -486,6 +500,7 @@ private:
   float _lambda;
   size_t _bag_size;
   uint32_t _num_bits;
+  VW::hash_func_t _hasher = VW::details::hashstring;
 
   uint32_t _stride_shift;
   bool _model_loaded;
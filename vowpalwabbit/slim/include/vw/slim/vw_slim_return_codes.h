@@ -11,6 +11,7 @@
 #define E_VW_PREDICT_ERR_EXPLORATION_FAILED 8
 #define E_VW_PREDICT_ERR_INVALID_MODEL_CHECK_SUM 9
 #define E_VW_PREDICT_ERR_HASH_SEED_NOT_SUPPORTED 10
+#define E_VW_PREDICT_ERR_HASH_ALGORITHM_NOT_SUPPORTED 11
 #define RETURN_ON_FAIL(stmt)                                    \
   {                                                             \
     int ret##__LINE__ = stmt;                                   \
@@ -244,8 +244,7 @@ private:
         }
 
         VW::string_view spelling_strview(_spelling.data(), _spelling.size());
-        word_hash =
-            VW::details::hashstring(spelling_strview.data(), spelling_strview.length(), (uint64_t)_channel_hash);
+        word_hash = _p->string_hasher(spelling_strview.data(), spelling_strview.length(), (uint64_t)_channel_hash);
         spell_fs.push_back(_v, word_hash, VW::details::SPELLING_NAMESPACE);
         if (audit)
         {
@@ -390,7 +389,7 @@ private:
         static const char* space = " ";
         _base = space;
       }
-      _channel_hash = this->_hash_seed == 0 ? 0 : VW::uniform_hash("", 0, this->_hash_seed);
+      _channel_hash = this->_hash_seed == 0 ? 0 : _p->uniform_hasher("", 0, this->_hash_seed);
       _ae->feature_space[_index].start_ns_extent(_channel_hash);
       did_start_extent = true;
       list_features();